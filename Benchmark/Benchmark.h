@@ -0,0 +1,79 @@
+/*
+ *******************************************************************************************
+ * Author	: Sang Hyun Son
+ * Email	: shh1295@gmail.com
+ * Github	: github.com/SonSang
+ *******************************************************************************************
+ */
+
+#ifndef __MN_BENCHMARK_H__
+#define __MN_BENCHMARK_H__
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#include "../Circle/Circle.h"
+#include <chrono>
+#include <random>
+
+namespace MN {
+	// Helpers shared by benchmarks and validation harnesses in this directory
+	// Every program is standalone, and is built together with the sources it measures
+	class Benchmark {
+	public:
+		// Keeps the best time over repeated runs, to reduce noise from other processes
+		struct Timer {
+			std::chrono::steady_clock::time_point begin;
+			double best = maxDouble;		// Best time in seconds
+
+			inline void start() {
+				begin = std::chrono::steady_clock::now();
+			}
+			inline void stop() {
+				double time = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+				if (time < best)
+					best = time;
+			}
+		};
+		// Set rotation of [ t ] to that around random axis by random angle in [ -maxAngle, maxAngle ]
+		inline static void randomRotation(std::mt19937& rng, Real maxAngle, Transform& t) {
+			std::uniform_real_distribution<Real> unit(-1, 1);
+			Vec3 axis;
+			do {
+				axis = { unit(rng), unit(rng), unit(rng) };
+			} while (axis.len() < 1e-3 || axis.len() > 1);
+			axis.normalize();
+
+			Real
+				angle = maxAngle * unit(rng),
+				c = cos(angle),
+				s = sin(angle),
+				x = axis[0],
+				y = axis[1],
+				z = axis[2];
+			t.R[0][0] = c + x * x * (1 - c);		t.R[0][1] = x * y * (1 - c) - z * s;	t.R[0][2] = x * z * (1 - c) + y * s;
+			t.R[1][0] = y * x * (1 - c) + z * s;	t.R[1][1] = c + y * y * (1 - c);		t.R[1][2] = y * z * (1 - c) - x * s;
+			t.R[2][0] = z * x * (1 - c) - y * s;	t.R[2][1] = z * y * (1 - c) + x * s;	t.R[2][2] = c + z * z * (1 - c);
+		}
+		// Random arc of [ radius ] : Full circle with probability 1/4, otherwise random domain wider than 0.5
+		inline static void randomArc(std::mt19937& rng, Real radius, CircularArc& arc) {
+			std::uniform_real_distribution<Real> unit(0, 1);
+			arc.radius = radius;
+			if (unit(rng) < 0.25)
+				arc.domain.set(0, PI20);
+			else {
+				Real beg = PI20 * unit(rng);
+				arc.domain.set(beg, beg + 0.5 + (PI20 - 0.5) * unit(rng));
+			}
+		}
+		// Random rotation, and translation in [ -maxTranslation, maxTranslation ]^3
+		inline static void randomTransform(std::mt19937& rng, Real maxTranslation, Transform& t) {
+			std::uniform_real_distribution<Real> unit(-1, 1);
+			t.clear();
+			randomRotation(rng, PI, t);
+			t.T = { unit(rng) * maxTranslation, unit(rng) * maxTranslation, unit(rng) * maxTranslation };
+		}
+	};
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,94 @@
+/*
+ *******************************************************************************************
+ * Author	: Sang Hyun Son
+ * Email	: shh1295@gmail.com
+ * Github	: github.com/SonSang
+ *******************************************************************************************
+ */
+
+// Time to isolate roots of binormal polynomials with Bezier subdivision, for random full circle pairs
+// Build : g++ -O2 -std=c++17 BezierBenchmark.cpp ../Circle/*.cpp -o BezierBenchmark
+
+#include "Benchmark.h"
+#include "../Circle/CircleBinormal.h"
+#include <cstdio>
+
+#define PAIR_NUM		20000		// Number of circle pairs
+#define REPEAT_NUM		5			// Best time over this number of runs is reported
+
+using namespace MN;
+
+int main() {
+	std::mt19937 rng(1);
+	std::uniform_real_distribution<Real> radius(0.5, 2.0);
+	std::vector<Circle> a(PAIR_NUM), b(PAIR_NUM);
+	std::vector<Transform> btoa(PAIR_NUM);
+	for (int i = 0; i < PAIR_NUM; i++) {
+		a[i].radius = radius(rng);
+		b[i].radius = radius(rng);
+		Benchmark::randomTransform(rng, 2.0, btoa[i]);
+	}
+
+	// 1. Scalar solve without refinement, where root isolation dominates
+	CircleBinormal::Workspace* ws = new CircleBinormal::Workspace();
+	std::vector<CircleBinormal::Binormal> bins;
+	Benchmark::Timer timer;
+	long long binNum = 0;
+	for (int r = 0; r < REPEAT_NUM; r++) {
+		binNum = 0;
+		timer.start();
+		for (int i = 0; i < PAIR_NUM; i++) {
+			CircleBinormal::solve(a[i], b[i], btoa[i], *ws, bins, false);
+			binNum += (long long)bins.size();
+		}
+		timer.stop();
+	}
+	printf("solve ( no refinement ) : %.3f us / pair, %lld binormals\n", timer.best / PAIR_NUM * 1e6, binNum);
+
+	// 2. Batched root isolation of the same polynomials
+	std::vector<Real> radiusA(PAIR_NUM), radiusB(PAIR_NUM), center[3], axisU[3], axisV[3];
+	for (int j = 0; j < 3; j++) {
+		center[j].resize(PAIR_NUM);
+		axisU[j].resize(PAIR_NUM);
+		axisV[j].resize(PAIR_NUM);
+	}
+	for (int i = 0; i < PAIR_NUM; i++) {
+		radiusA[i] = a[i].radius;
+		radiusB[i] = b[i].radius;
+		for (int j = 0; j < 3; j++) {
+			center[j][i] = btoa[i].T[j];
+			axisU[j][i] = btoa[i].R[j][0];
+			axisV[j][i] = btoa[i].R[j][1];
+		}
+	}
+	CircleBinormal::PairBatch batch;
+	batch.num = PAIR_NUM;
+	batch.radiusA = radiusA.data();
+	batch.radiusB = radiusB.data();
+	for (int j = 0; j < 3; j++) {
+		batch.center[j] = center[j].data();
+		batch.axisU[j] = axisU[j].data();
+		batch.axisV[j] = axisV[j].data();
+	}
+	std::vector<Real> coefs(9 * PAIR_NUM), roots(CircleBinormal::maxRootNum * PAIR_NUM);
+	std::vector<int> rootNum(PAIR_NUM);
+	CircleBinormal::buildPolynomials(batch, coefs.data());
+
+	CircleBinormal::BatchWorkspace* bws = new CircleBinormal::BatchWorkspace();
+	Domain domain;
+	domain.set(-1.0, 1.0);
+	long long totalRootNum = 0;
+	timer = Benchmark::Timer();
+	for (int r = 0; r < REPEAT_NUM; r++) {
+		timer.start();
+		CircleBinormal::solvePolynomials(PAIR_NUM, coefs.data(), &domain, 1, roots.data(), rootNum.data(), *bws);
+		timer.stop();
+	}
+	for (int i = 0; i < PAIR_NUM; i++)
+		totalRootNum += rootNum[i];
+	printf("solvePolynomials : %.3f us / polynomial, %lld roots\n", timer.best / PAIR_NUM * 1e6, totalRootNum);
+
+	delete ws;
+	delete bws;
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,212 @@
+/*
+ *******************************************************************************************
+ * Author	: Sang Hyun Son
+ * Email	: shh1295@gmail.com
+ * Github	: github.com/SonSang
+ *******************************************************************************************
+ */
+
+// Differential test of [ CircleBinormal::solve ] against [ CircleBinormal::bruteSolve ]
+// Random arc pairs are generated from a seed, and every other pair is adversarial :
+// Nearly coaxial, nearly parallel, center near the other's axis, touching, or extreme radius ratio
+// Pairs are split over threads, and each thread has its own solver and workspace
+// Near coaxial pose, binormals move along a nearly flat valley, so the same binormal can be found at slightly different parameters by both solvers
+// Such a pair of missed and spurious binormals is counted as shifted, and the exit code is 1 only if other mismatches remain
+// Usage : CircleBinormalValidation [ pairNum ] [ seed ] [ threadNum ] [ sampleNum ]
+// Build : g++ -O2 -std=c++17 -pthread CircleBinormalValidation.cpp ../Circle/*.cpp -o CircleBinormalValidation
+
+#include "Benchmark.h"
+#include "../Circle/CircleBinormal.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+#define PARAM_EPS		1e-6		// Two binormals are regarded as same if their parameters differ less than this
+#define SHIFT_PARAM_EPS	1e-4		// Missed and spurious binormals are regarded as shifted if their parameters differ less than this,
+#define SHIFT_DIST_EPS	1e-9		// and their distances differ less than this ( relative to the larger distance )
+
+using namespace MN;
+
+struct Validation {
+	int pairNum = 0;
+	int bruteNum = 0;		// Binormals found by [ bruteSolve ]
+	int missNum = 0;		// Binormals found by [ bruteSolve ], but not by [ solve ]
+	int spuriousNum = 0;	// Binormals found by [ solve ], but not by [ bruteSolve ]
+	int shiftNum = 0;		// Pairs of missed and spurious binormals that are the same binormal at shifted parameters
+	int failPairNum = 0;	// Pairs with at least one missed or spurious binormal
+	double solveTime = 0;	// Accumulated time of [ solve ] in seconds
+	double bruteTime = 0;	// Accumulated time of [ bruteSolve ] in seconds
+
+	inline Validation& operator+=(const Validation& v) noexcept {
+		pairNum += v.pairNum;
+		bruteNum += v.bruteNum;
+		missNum += v.missNum;
+		spuriousNum += v.spuriousNum;
+		shiftNum += v.shiftNum;
+		failPairNum += v.failPairNum;
+		solveTime += v.solveTime;
+		bruteTime += v.bruteTime;
+		return *this;
+	}
+};
+struct Pair {
+	CircularArc a;
+	CircularArc b;
+	Transform tB;			// Transformation of [ b ] in [ a ]'s local coordinates
+};
+
+static bool sameParam(Real x, Real y, Real eps = PARAM_EPS) {
+	Real diff = fabs(piDomain::regularize(x) - piDomain::regularize(y));
+	return (diff < eps) || (diff > PI20 - eps);
+}
+// Find if general binormals [ x ] and [ y ] are the same binormal at shifted parameters
+static bool isShifted(const CircleBinormal::Binormal& x, const CircleBinormal::Binormal& y) {
+	return sameParam(x.paramA, y.paramA, SHIFT_PARAM_EPS) && sameParam(x.paramB, y.paramB, SHIFT_PARAM_EPS) &&
+		fabs(x.distance - y.distance) <= SHIFT_DIST_EPS * std::max(x.distance, y.distance);
+}
+// Find if binormal [ bin ] is one of [ bins ]
+static bool hasBinormal(const std::vector<CircleBinormal::Binormal>& bins, const CircleBinormal::Binormal& bin) {
+	for (auto& cbin : bins) {
+		bool sameA = sameParam(cbin.paramA, bin.paramA);
+		bool sameB = sameParam(cbin.paramB, bin.paramB);
+		if ((cbin.type == 0 && sameA && sameB) || (cbin.type == 2 && sameB) || (cbin.type == 3 && sameA))
+			return true;
+	}
+	return false;
+}
+// Compare results of [ solve ] and [ bruteSolve ] for a single pair and accumulate them in [ validation ]
+static void validate(const Pair& pair, CircleBinormal& solver, CircleBinormal::Workspace& ws, int sampleNum, Validation& validation) {
+	Transform tA;
+	tA.clear();
+	std::vector<CircleBinormal::Binormal> sbins, bbins;
+	auto time0 = std::chrono::steady_clock::now();
+	CircleBinormal::solve(pair.a, pair.b, tA, pair.tB, ws, sbins);
+	auto time1 = std::chrono::steady_clock::now();
+	solver.bruteSolve(pair.a, pair.b, tA, pair.tB, bbins, 1e-10, sampleNum);
+	auto time2 = std::chrono::steady_clock::now();
+
+	validation.pairNum++;
+	validation.solveTime += std::chrono::duration<double>(time1 - time0).count();
+	validation.bruteTime += std::chrono::duration<double>(time2 - time1).count();
+
+	// Every pair of points forms binormal, which cannot be compared with samples
+	for (auto& bin : sbins)
+		if (bin.type == 1)
+			return;
+
+	std::vector<CircleBinormal::Binormal> missed, spurious;
+	for (auto& bin : bbins)
+		if (!hasBinormal(sbins, bin))
+			missed.push_back(bin);
+	for (auto& bin : sbins)
+		if (bin.type == 0 && !hasBinormal(bbins, bin))
+			spurious.push_back(bin);
+
+	// Pair up shifted ones, which are not counted as mismatches
+	int shiftNum = 0;
+	for (auto& mbin : missed) {
+		if (mbin.type != 0)
+			continue;
+		for (auto& sbin : spurious) {
+			if (sbin.type == 0 && isShifted(mbin, sbin)) {
+				sbin.type = -1;		// Matched
+				shiftNum++;
+				break;
+			}
+		}
+	}
+	int
+		missNum = (int)missed.size() - shiftNum,
+		spuriousNum = (int)spurious.size() - shiftNum;
+
+	validation.bruteNum += (int)bbins.size();
+	validation.missNum += missNum;
+	validation.spuriousNum += spuriousNum;
+	validation.shiftNum += shiftNum;
+	if (missNum > 0 || spuriousNum > 0)
+		validation.failPairNum++;
+}
+// Validate pairs in [ beg, end )
+static void validateRange(const std::vector<Pair>* pairs, int beg, int end, int sampleNum, Validation* validation) {
+	CircleBinormal solver;
+	CircleBinormal::Workspace* ws = new CircleBinormal::Workspace();
+	for (int i = beg; i < end; i++)
+		validate((*pairs)[i], solver, *ws, sampleNum, *validation);
+	delete ws;
+}
+static void generatePairs(int pairNum, unsigned int seed, std::vector<Pair>& pairs) {
+	std::mt19937 rng(seed);
+	std::uniform_real_distribution<Real> unit(-1, 1);
+	pairs.resize(pairNum);
+	for (int i = 0; i < pairNum; i++) {
+		Transform& tB = pairs[i].tB;
+		Real radiusB = 1.1 + unit(rng) * 0.9;
+		Benchmark::randomTransform(rng, 2.0, tB);
+
+		if (i % 2 == 1) {
+			switch ((i / 2) % 5) {
+			case 0:
+				// Nearly coaxial
+				Benchmark::randomRotation(rng, 1e-4, tB);
+				tB.T = { unit(rng) * 1e-4, unit(rng) * 1e-4, unit(rng) };
+				break;
+			case 1:
+				// Nearly parallel
+				Benchmark::randomRotation(rng, 1e-6, tB);
+				break;
+			case 2:
+				// Center of [ b ] near the axis of [ a ]
+				tB.T = { unit(rng) * 1e-6, unit(rng) * 1e-6, unit(rng) * 2 };
+				break;
+			case 3: {
+				// [ b ] touches [ a ]
+				Real ta = PI * unit(rng), tb = PI * unit(rng);
+				Vec3 pa{ cos(ta), sin(ta), 0 };
+				Vec3 pb{ radiusB * cos(tb), radiusB * sin(tb), 0 };
+				tB.T = pa - tB.applyR(pb);
+				break;
+			}
+			default:
+				// Extreme radius ratio
+				radiusB = (unit(rng) < 0) ? 1e-3 : 1e3;
+				tB.T = tB.T * radiusB;
+				break;
+			}
+		}
+		Benchmark::randomArc(rng, 1.0, pairs[i].a);
+		Benchmark::randomArc(rng, radiusB, pairs[i].b);
+	}
+}
+int main(int argc, char** argv) {
+	int pairNum = (argc > 1) ? atoi(argv[1]) : 4000;
+	unsigned int seed = (argc > 2) ? (unsigned int)atoi(argv[2]) : 1;
+	int threadNum = (argc > 3) ? atoi(argv[3]) : 0;
+	int sampleNum = (argc > 4) ? atoi(argv[4]) : 1000;
+	if (threadNum <= 0)
+		threadNum = std::max(1, (int)std::thread::hardware_concurrency());
+	threadNum = std::min(threadNum, std::max(1, pairNum));
+
+	std::vector<Pair> pairs;
+	generatePairs(pairNum, seed, pairs);
+
+	std::vector<Validation> validations(threadNum);
+	std::vector<std::thread> threads;
+	auto time0 = std::chrono::steady_clock::now();
+	for (int i = 0; i < threadNum; i++) {
+		int beg = (int)((long long)pairNum * i / threadNum);
+		int end = (int)((long long)pairNum * (i + 1) / threadNum);
+		threads.emplace_back(validateRange, &pairs, beg, end, sampleNum, &validations[i]);
+	}
+	for (auto& thread : threads)
+		thread.join();
+	double time = std::chrono::duration<double>(std::chrono::steady_clock::now() - time0).count();
+
+	Validation validation;
+	for (auto& v : validations)
+		validation += v;
+	printf("pairs %d, threads %d, wall time %.2f s\n", validation.pairNum, threadNum, time);
+	printf("brute binormals %d, missed %d, spurious %d, shifted %d, failing pairs %d\n", validation.bruteNum, validation.missNum, validation.spuriousNum, validation.shiftNum, validation.failPairNum);
+	printf("solve %.2f us / pair, bruteSolve %.2f us / pair ( x %.1f )\n", validation.solveTime / validation.pairNum * 1e6, validation.bruteTime / validation.pairNum * 1e6, validation.bruteTime / validation.solveTime);
+	return (validation.failPairNum == 0) ? 0 : 1;
+}
\ No newline at end of file
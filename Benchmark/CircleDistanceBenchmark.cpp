@@ -0,0 +1,132 @@
+/*
+ *******************************************************************************************
+ * Author	: Sang Hyun Son
+ * Email	: shh1295@gmail.com
+ * Github	: github.com/SonSang
+ *******************************************************************************************
+ */
+
+// Time to find minimum distance between random full circle pairs by Vranek's algorithm, one by one and in batch
+// Accuracy is measured against the minimum over dense samples of circle B refined by its nearest points on circle A
+// Batch only pays off when its lane loops are vectorized, so build it with -O3 -march=native -fno-math-errno as well
+// Build : g++ -O2 -std=c++17 CircleDistanceBenchmark.cpp ../Circle/*.cpp -o CircleDistanceBenchmark
+
+#include "Benchmark.h"
+#include "../Circle/CircleDistance.h"
+#include <cstdio>
+
+#define PAIR_NUM		20000		// Number of circle pairs
+#define REPEAT_NUM		5			// Best time over this number of runs is reported
+#define CHECK_SAMPLE	4096		// Number of samples on circle B to compute reference distance
+#define CHECK_EPS		1e-6		// Result is regarded as wrong if it is longer than reference by this
+
+using namespace MN;
+
+// Minimum distance over samples of [ b ], each refined by golden section search around it
+static Real referenceDistance(const Circle& a, const Circle& b, const Transform& btoa) {
+	Real best = maxDouble;
+	for (int i = 0; i < CHECK_SAMPLE; i++) {
+		Real lo = PI20 * (i - 1) / CHECK_SAMPLE, hi = PI20 * (i + 1) / CHECK_SAMPLE;
+		for (int k = 0; k < 40; k++) {
+			Real m1 = lo + (hi - lo) * 0.381966011250105, m2 = lo + (hi - lo) * 0.618033988749895;
+			Vec3 p1 = btoa.apply(b.evaluate(m1)), p2 = btoa.apply(b.evaluate(m2));
+			Real t1, t2;
+			a.findMinDistParam(p1, t1);
+			a.findMinDistParam(p2, t2);
+			if ((a.evaluate(t1) - p1).len() < (a.evaluate(t2) - p2).len())
+				hi = m2;
+			else
+				lo = m1;
+		}
+		Vec3 p = btoa.apply(b.evaluate((lo + hi) * 0.5));
+		Real t;
+		a.findMinDistParam(p, t);
+		best = std::min(best, (a.evaluate(t) - p).len());
+	}
+	return best;
+}
+
+int main() {
+	std::mt19937 rng(1);
+	std::uniform_real_distribution<Real> radius(0.5, 2.0);
+	std::vector<Circle> a(PAIR_NUM), b(PAIR_NUM);
+	std::vector<Transform> tA(PAIR_NUM), btoa(PAIR_NUM);
+	std::vector<Real> radiusA(PAIR_NUM), radiusB(PAIR_NUM), center[3], axisU[3], axisV[3];
+	for (int j = 0; j < 3; j++) {
+		center[j].resize(PAIR_NUM);
+		axisU[j].resize(PAIR_NUM);
+		axisV[j].resize(PAIR_NUM);
+	}
+	for (int i = 0; i < PAIR_NUM; i++) {
+		a[i].radius = radius(rng);
+		b[i].radius = radius(rng);
+		tA[i].clear();
+		Benchmark::randomTransform(rng, 2.0, btoa[i]);
+
+		radiusA[i] = a[i].radius;
+		radiusB[i] = b[i].radius;
+		for (int j = 0; j < 3; j++) {
+			center[j][i] = btoa[i].T[j];
+			axisU[j][i] = btoa[i].R[j][0];
+			axisV[j][i] = btoa[i].R[j][1];
+		}
+	}
+	CircleBinormal::PairBatch batch;
+	batch.num = PAIR_NUM;
+	batch.radiusA = radiusA.data();
+	batch.radiusB = radiusB.data();
+	for (int j = 0; j < 3; j++) {
+		batch.center[j] = center[j].data();
+		batch.axisU[j] = axisU[j].data();
+		batch.axisV[j] = axisV[j].data();
+	}
+
+	// 1. Time
+	std::vector<Distance> distances(PAIR_NUM);
+	Benchmark::Timer timer;
+	int failNum = 0;
+	for (int r = 0; r < REPEAT_NUM; r++) {
+		failNum = 0;
+		timer.start();
+		for (int i = 0; i < PAIR_NUM; i++)
+			failNum += (distance(a[i], b[i], tA[i], btoa[i], distances[i]) != CircleDistanceStatus::Success);
+		timer.stop();
+	}
+	printf("distance : %.3f us / pair, %d pairs fell back to binormals\n", timer.best / PAIR_NUM * 1e6, failNum);
+
+	// 2. Time in batch
+	std::vector<Distance> batchDistances(PAIR_NUM);
+	Benchmark::Timer batchTimer;
+	for (int r = 0; r < REPEAT_NUM; r++) {
+		batchTimer.start();
+		distance(batch, batchDistances.data());
+		batchTimer.stop();
+	}
+	printf("distance in batch : %.3f us / pair\n", batchTimer.best / PAIR_NUM * 1e6);
+
+	// 3. Difference between batch and scalar, positive if batch gives longer distance
+	int longerNum = 0, shorterNum = 0;
+	Real maxLonger = 0, maxShorter = 0;
+	for (int i = 0; i < PAIR_NUM; i++) {
+		Real diff = batchDistances[i].length - distances[i].length;
+		if (diff > CHECK_EPS) {
+			longerNum++;
+			maxLonger = std::max(maxLonger, diff);
+		}
+		else if (diff < -CHECK_EPS) {
+			shorterNum++;
+			maxShorter = std::max(maxShorter, -diff);
+		}
+	}
+	printf("batch longer in %d pairs ( max %.3e ), shorter in %d pairs ( max %.3e )\n", longerNum, maxLonger, shorterNum, maxShorter);
+
+	// 4. Accuracy on a subset
+	int checkNum = PAIR_NUM / 20, wrongNum = 0, batchWrongNum = 0;
+	for (int i = 0; i < checkNum; i++) {
+		Real reference = referenceDistance(a[i], b[i], btoa[i]);
+		wrongNum += (distances[i].length > reference + CHECK_EPS);
+		batchWrongNum += (batchDistances[i].length > reference + CHECK_EPS);
+	}
+	printf("wrong distances : %d in %d pairs, %d in batch\n", wrongNum, checkNum, batchWrongNum);
+	return 0;
+}
\ No newline at end of file
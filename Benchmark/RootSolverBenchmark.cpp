@@ -0,0 +1,103 @@
+/*
+ *******************************************************************************************
+ * Author	: Sang Hyun Son
+ * Email	: shh1295@gmail.com
+ * Github	: github.com/SonSang
+ *******************************************************************************************
+ */
+
+// Speed and missed roots of each root solver backend of binormal polynomial
+// Binormals found by [ bruteSolve ] but not by [ solve ] are counted as missed
+// Build : g++ -O2 -std=c++17 -pthread RootSolverBenchmark.cpp ../Circle/*.cpp -o RootSolverBenchmark
+
+#include "Benchmark.h"
+#include "../Circle/CircleBinormal.h"
+#include <cstdio>
+
+#define PAIR_NUM		300			// Number of circle pairs in each set
+#define REPEAT_NUM		5			// Best time over this number of runs is reported
+#define PARAM_EPS		1e-6		// Two binormals are regarded as same if their parameters differ less than this
+
+using namespace MN;
+
+static bool sameParam(Real x, Real y) {
+	Real diff = fabs(piDomain::regularize(x) - piDomain::regularize(y));
+	return (diff < PARAM_EPS) || (diff > PI20 - PARAM_EPS);
+}
+static int missNum(const std::vector<CircleBinormal::Binormal>& bins, const std::vector<CircleBinormal::Binormal>& bruteBins) {
+	int num = 0;
+	for (auto& bbin : bruteBins) {
+		bool found = false;
+		for (auto& bin : bins) {
+			if (bin.type == 1 || (sameParam(bin.paramA, bbin.paramA) && sameParam(bin.paramB, bbin.paramB))) {
+				found = true;
+				break;
+			}
+		}
+		if (!found)
+			num++;
+	}
+	return num;
+}
+// @eps :	If positive, pairs are coaxial with nearly equal radii, perturbed by [ eps ], where roots of the polynomial nearly coincide
+//			Otherwise, pairs are random
+static void run(const char* name, Real eps) {
+	std::mt19937 rng(eps > 0 ? 2 : 1);
+	std::uniform_real_distribution<Real> unit(-1, 1);
+	std::vector<CircularArc> a(PAIR_NUM), b(PAIR_NUM);
+	std::vector<Transform> btoa(PAIR_NUM);
+	for (int i = 0; i < PAIR_NUM; i++) {
+		a[i].domain.set(0, PI20);
+		b[i].domain.set(0, PI20);
+		a[i].radius = 1.25 + 0.75 * unit(rng);
+		if (eps > 0) {
+			b[i].radius = a[i].radius * (1 + eps * unit(rng));
+			btoa[i].clear();
+			Benchmark::randomRotation(rng, eps, btoa[i]);
+			btoa[i].T = { eps * unit(rng), eps * unit(rng), unit(rng) };
+		}
+		else {
+			b[i].radius = 1.25 + 0.75 * unit(rng);
+			Benchmark::randomTransform(rng, 2.0, btoa[i]);
+		}
+	}
+
+	// Binormals found by sampling, which do not depend on root solver
+	CircleBinormal cb;
+	Transform identity;
+	identity.clear();
+	std::vector<std::vector<CircleBinormal::Binormal>> bruteBins(PAIR_NUM);
+	int bruteNum = 0;
+	for (int i = 0; i < PAIR_NUM; i++) {
+		cb.bruteSolve(a[i], b[i], identity, btoa[i], bruteBins[i]);
+		bruteNum += (int)bruteBins[i].size();
+	}
+
+	const CircleBinormal::RootSolver solvers[3] = { CircleBinormal::RootSolver::Bezier, CircleBinormal::RootSolver::Descartes, CircleBinormal::RootSolver::Companion };
+	const char* solverNames[3] = { "Bezier", "Descartes", "Companion" };
+	CircleBinormal::Workspace* ws = new CircleBinormal::Workspace();
+	std::vector<CircleBinormal::Binormal> bins;
+	for (int s = 0; s < 3; s++) {
+		ws->rootSolver = solvers[s];
+		Benchmark::Timer timer;
+		for (int r = 0; r < REPEAT_NUM; r++) {
+			timer.start();
+			for (int i = 0; i < PAIR_NUM; i++)
+				CircleBinormal::solve(a[i], b[i], btoa[i], *ws, bins);
+			timer.stop();
+		}
+		int miss = 0;
+		for (int i = 0; i < PAIR_NUM; i++) {
+			CircleBinormal::solve(a[i], b[i], btoa[i], *ws, bins);
+			miss += missNum(bins, bruteBins[i]);
+		}
+		printf("%s / %s : %.2f us / pair ( %.0f pairs / s ), missed %d / %d\n", name, solverNames[s], timer.best / PAIR_NUM * 1e6, PAIR_NUM / timer.best, miss, bruteNum);
+	}
+	delete ws;
+}
+int main() {
+	run("random", 0);
+	run("near degenerate ( 1e-3 )", 1e-3);
+	run("near degenerate ( 1e-4 )", 1e-4);
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,103 @@
+/*
+ *******************************************************************************************
+ * Author	: Sang Hyun Son
+ * Email	: shh1295@gmail.com
+ * Github	: github.com/SonSang
+ *******************************************************************************************
+ */
+
+// Time of callers that need several derivatives of torus at the same ( u, v ) : refinement of closest point and [ TorusApprox::Mapping::set ]
+// Only uses interfaces that exist before [ SurfaceJet ], so that it can be built on both sides of the change and compared
+// Checksum has to be the same on both sides
+// Build : g++ -O2 -std=c++17 SurfaceJetBenchmark.cpp ../Torus/Torus.cpp ../Torus/TorusApprox.cpp ../Circle/*.cpp -o SurfaceJetBenchmark
+
+#include "Benchmark.h"
+#include "../Torus/TorusApprox.h"
+#include <cstdio>
+
+#define QUERY_NUM		200000		// Number of refinements and mappings
+#define REPEAT_NUM		5			// Best time over this number of runs is reported
+
+using namespace MN;
+
+int main() {
+	std::mt19937 rng(1);
+	std::uniform_real_distribution<Real> unit(0, 1), coord(-3, 3);
+	StaticTorus torus;
+	torus.majorRadius = 1.5;
+	torus.minorRadius = 0.5;
+	TorusPatch patch;
+	patch.majorRadius = 1.5;
+	patch.minorRadius = 0.5;
+	patch.uDomain.set(0.3, 2.5);
+	patch.vDomain.set(1.0, 4.0);
+
+	std::vector<Vec3> points(QUERY_NUM);
+	std::vector<Real> u0(QUERY_NUM), v0(QUERY_NUM);
+	for (int i = 0; i < QUERY_NUM; i++) {
+		points[i] = { coord(rng), coord(rng), coord(rng) / 3 };
+		u0[i] = PI20 * unit(rng);
+		v0[i] = PI20 * unit(rng);
+	}
+	Real checksum = 0;
+
+	// 1. Refinement on full torus, from random starting parameters
+	Benchmark::Timer timer;
+	for (int r = 0; r < REPEAT_NUM; r++) {
+		Real sum = 0;
+		timer.start();
+		for (int i = 0; i < QUERY_NUM; i++) {
+			Real u = u0[i], v = v0[i];
+			torus.minDistParamRefine(points[i], u, v);
+			sum += u + v;
+		}
+		timer.stop();
+		checksum = sum;
+	}
+	printf("StaticTorus::minDistParamRefine : %.1f ns / query\n", timer.best / QUERY_NUM * 1e9);
+
+	// 2. Refinement on patch, from the middle of domain
+	timer = Benchmark::Timer();
+	for (int r = 0; r < REPEAT_NUM; r++) {
+		Real sum = 0;
+		timer.start();
+		for (int i = 0; i < QUERY_NUM; i++) {
+			Real u = patch.uDomain.middle(), v = patch.vDomain.middle();
+			patch.minDistParamRefine(points[i], u, v);
+			sum += u + v;
+		}
+		timer.stop();
+		checksum += (r == 0) ? sum : 0;
+	}
+	printf("TorusPatch::minDistParamRefine : %.1f ns / query\n", timer.best / QUERY_NUM * 1e9);
+
+	// 3. Mapping between parameters of a surface and its torus approximation
+	TorusApprox approx;
+	approx.patch = patch;
+	Benchmark::randomTransform(rng, 1.0, approx.transform);
+	TorusApprox::SurfaceInfo surface;
+	surface.Fu = { 1.0, 0.1, 0.0 };
+	surface.Fv = { 0.1, 1.0, 0.2 };
+	surface.Fuu = { 0.1, 0.2, 0.3 };
+	surface.Fuv = { 0.05, 0.0, 0.1 };
+	surface.Fvv = { 0.2, 0.1, 0.0 };
+	surface.u = 0.5;
+	surface.v = 0.5;
+	surface.uDomain.set(0, 1);
+	surface.vDomain.set(0, 1);
+	TorusApprox::Mapping mapping;
+	timer = Benchmark::Timer();
+	for (int r = 0; r < REPEAT_NUM; r++) {
+		Real sum = 0;
+		timer.start();
+		for (int i = 0; i < QUERY_NUM; i++) {
+			mapping.set(surface, approx, u0[i], v0[i]);
+			sum += mapping.mCoefs[0] + mapping.nCoefs[5];
+		}
+		timer.stop();
+		checksum += (r == 0) ? sum : 0;
+	}
+	printf("TorusApprox::Mapping::set : %.1f ns / query\n", timer.best / QUERY_NUM * 1e9);
+	printf("checksum : %.12e\n", checksum);
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,132 @@
+/*
+ *******************************************************************************************
+ * Author	: Sang Hyun Son
+ * Email	: shh1295@gmail.com
+ * Github	: github.com/SonSang
+ *******************************************************************************************
+ */
+
+// Time to project random points onto random torus patches, through virtual [ TorusPatch ] and [ StaticTorusPatch ]
+// Virtual patches are called through pointers to [ Torus ], as in containers of mixed primitives
+// Then [ findMinDistParamBoundary ] is compared with [ findMinDistParam ] in time and distance, for random points,
+// points whose direction is out of [ uDomain ] ( so that [ u ] is clamped ), and spindle tori ( R < r )
+// Build : g++ -O2 -std=c++17 TorusPatchBenchmark.cpp ../Torus/Torus.cpp ../Circle/*.cpp -o TorusPatchBenchmark
+
+#include "Benchmark.h"
+#include "../Torus/Torus.h"
+#include <cstdio>
+
+#define PATCH_NUM		1024		// Number of torus patches
+#define QUERY_NUM		1000000		// Number of projections
+#define REPEAT_NUM		5			// Best time over this number of runs is reported
+
+using namespace MN;
+
+// Compare [ findMinDistParamBoundary ] with [ findMinDistParam ] on [ patches ]
+static void boundaryBenchmark(const char* name, const std::vector<StaticTorusPatch>& patches, const std::vector<Vec3>& points, const std::vector<int>& ids) {
+	const int num = (int)points.size();
+	std::vector<Real> u0(num), v0(num), u1(num), v1(num);
+	Benchmark::Timer refineTimer, boundaryTimer;
+	for (int r = 0; r < REPEAT_NUM; r++) {
+		refineTimer.start();
+		for (int i = 0; i < num; i++)
+			patches[ids[i]].findMinDistParam(points[i], u0[i], v0[i]);
+		refineTimer.stop();
+		boundaryTimer.start();
+		for (int i = 0; i < num; i++)
+			patches[ids[i]].findMinDistParamBoundary(points[i], u1[i], v1[i]);
+		boundaryTimer.stop();
+	}
+
+	// Distance gap : Positive if [ findMinDistParamBoundary ] gives closer point
+	int refineWorseNum = 0, boundaryWorseNum = 0;
+	Real refineWorstGap = 0, boundaryWorstGap = 0;
+	for (int i = 0; i < num; i++) {
+		const StaticTorusPatch& patch = patches[ids[i]];
+		Real gap = points[i].dist(patch.evaluate(u0[i], v0[i])) - points[i].dist(patch.evaluate(u1[i], v1[i]));
+		if (gap > 1e-12) {
+			refineWorseNum++;
+			refineWorstGap = std::max(refineWorstGap, gap);
+		}
+		else if (gap < -1e-12) {
+			boundaryWorseNum++;
+			boundaryWorstGap = std::max(boundaryWorstGap, -gap);
+		}
+	}
+	printf("%s : findMinDistParam %.1f ns / query, findMinDistParamBoundary %.1f ns / query\n", name, refineTimer.best / num * 1e9, boundaryTimer.best / num * 1e9);
+	printf("%s : findMinDistParam farther in %d queries ( max %.3e ), findMinDistParamBoundary farther in %d queries ( max %.3e )\n",
+		name, refineWorseNum, refineWorstGap, boundaryWorseNum, boundaryWorstGap);
+}
+int main() {
+	std::mt19937 rng(1);
+	std::uniform_real_distribution<Real> unit(0, 1), coord(-3, 3);
+	std::vector<TorusPatch> patches(PATCH_NUM);
+	std::vector<const Torus*> virtualPatches(PATCH_NUM);
+	std::vector<StaticTorusPatch> staticPatches(PATCH_NUM);
+	for (int i = 0; i < PATCH_NUM; i++) {
+		TorusPatch& p = patches[i];
+		p.majorRadius = 1.0 + unit(rng);
+		p.minorRadius = 0.2 + 0.6 * unit(rng);
+		Real ubeg = PI20 * unit(rng), vbeg = PI20 * unit(rng);
+		p.uDomain.set(ubeg, ubeg + 0.5 + (PI20 - 0.5) * unit(rng));
+		p.vDomain.set(vbeg, vbeg + 0.5 + (PI20 - 0.5) * unit(rng));
+		virtualPatches[i] = &p;
+		staticPatches[i] = StaticTorusPatch::create(p);
+	}
+	std::vector<Vec3> points(QUERY_NUM);
+	std::vector<int> ids(QUERY_NUM);
+	for (int i = 0; i < QUERY_NUM; i++) {
+		points[i] = { coord(rng), coord(rng), coord(rng) };
+		ids[i] = (int)(rng() % PATCH_NUM);
+	}
+	printf("sizeof : TorusPatch %d bytes, StaticTorusPatch %d bytes\n", (int)sizeof(TorusPatch), (int)sizeof(StaticTorusPatch));
+
+	// 1. Virtual
+	std::vector<Real> u0(QUERY_NUM), v0(QUERY_NUM);
+	Benchmark::Timer timer;
+	for (int r = 0; r < REPEAT_NUM; r++) {
+		timer.start();
+		for (int i = 0; i < QUERY_NUM; i++)
+			virtualPatches[ids[i]]->findMinDistParam(points[i], u0[i], v0[i]);
+		timer.stop();
+	}
+	printf("TorusPatch : %.1f ns / query\n", timer.best / QUERY_NUM * 1e9);
+
+	// 2. Static
+	std::vector<Real> u1(QUERY_NUM), v1(QUERY_NUM);
+	timer = Benchmark::Timer();
+	for (int r = 0; r < REPEAT_NUM; r++) {
+		timer.start();
+		for (int i = 0; i < QUERY_NUM; i++)
+			staticPatches[ids[i]].findMinDistParam(points[i], u1[i], v1[i]);
+		timer.stop();
+	}
+	printf("StaticTorusPatch : %.1f ns / query\n", timer.best / QUERY_NUM * 1e9);
+
+	int diffNum = 0;
+	for (int i = 0; i < QUERY_NUM; i++)
+		diffNum += (u0[i] != u1[i] || v0[i] != v1[i]);
+	printf("different parameters : %d in %d queries\n", diffNum, QUERY_NUM);
+
+	// 3. Boundary projection, for random points
+	boundaryBenchmark("Random", staticPatches, points, ids);
+
+	// 4. Points whose direction is out of [ uDomain ], so that [ u ] is clamped
+	std::vector<Vec3> clampedPoints(QUERY_NUM);
+	for (int i = 0; i < QUERY_NUM; i++) {
+		const StaticTorusPatch& patch = staticPatches[ids[i]];
+		Real
+			u = patch.uDomain.end() + (PI20 - patch.uDomain.width()) * unit(rng),
+			rho = 3.0 * unit(rng);
+		clampedPoints[i] = { rho * cos(u), rho * sin(u), coord(rng) };
+	}
+	boundaryBenchmark("Clamped u", staticPatches, clampedPoints, ids);
+
+	// 5. Spindle tori, whose minor radius is larger than major radius
+	std::vector<StaticTorusPatch> spindlePatches(staticPatches);
+	for (auto& patch : spindlePatches) {
+		patch.minorRadius = patch.majorRadius * (1.1 + unit(rng));
+	}
+	boundaryBenchmark("Spindle", spindlePatches, points, ids);
+	return 0;
+}
\ No newline at end of file
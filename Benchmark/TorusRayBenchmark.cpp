@@ -0,0 +1,95 @@
+/*
+ *******************************************************************************************
+ * Author	: Sang Hyun Son
+ * Email	: shh1295@gmail.com
+ * Github	: github.com/SonSang
+ *******************************************************************************************
+ */
+
+// Time to intersect camera rays with a torus patch, one by one and in packets of 4, 8, 16 rays
+// Packets vectorize only with -O3 -fno-math-errno -fno-trapping-math on GCC
+// Build : g++ -O3 -fno-math-errno -fno-trapping-math -march=native -std=c++17 TorusRayBenchmark.cpp ../Torus/Torus.cpp ../Torus/TorusIntersect.cpp ../Circle/*.cpp -o TorusRayBenchmark
+
+#include "Benchmark.h"
+#include "../Torus/TorusIntersect.h"
+#include <cstdio>
+
+#define IMAGE_SIZE		512			// Number of pixels along each side of image
+#define REPEAT_NUM		5			// Best time over this number of runs is reported
+
+using namespace MN;
+
+static std::vector<Ray> rays;
+
+template<int N>
+static void packetBenchmark(const TorusPatch& patch, const std::vector<RayHit>& hits) {
+	RayPacket<N> packet;
+	RayPacketHit<N> hit;
+	int hitNum = 0, diffNum = 0;
+	Benchmark::Timer timer;
+	for (int r = 0; r < REPEAT_NUM; r++) {
+		hitNum = 0;
+		timer.start();
+		for (int b = 0; b < (int)rays.size(); b += N) {
+			for (int i = 0; i < N; i++) {
+				const Ray& ray = rays[b + i];
+				packet.ox[i] = ray.origin[0];
+				packet.oy[i] = ray.origin[1];
+				packet.oz[i] = ray.origin[2];
+				packet.dx[i] = ray.direction[0];
+				packet.dy[i] = ray.direction[1];
+				packet.dz[i] = ray.direction[2];
+				packet.tMin[i] = 0.0;
+				packet.tMax[i] = maxDouble;
+			}
+			hitNum += intersect(patch, packet, hit);
+			if (r == 0) {
+				for (int i = 0; i < N; i++)
+					diffNum += hit.hit[i] ? (fabs(hit.t[i] - hits[b + i].t) > 1e-9) : (hits[b + i].t >= 0.0);
+			}
+		}
+		timer.stop();
+	}
+	printf("Packet %d : %.1f ns / ray, %d hits, %d different from scalar\n", N, timer.best / rays.size() * 1e9, hitNum, diffNum);
+}
+int main() {
+	TorusPatch patch;
+	patch.majorRadius = 1.5;
+	patch.minorRadius = 0.5;
+	patch.uDomain.set(0.3, 5.5);
+	patch.vDomain.set(0, PI20);
+
+	// Camera looking down at the patch
+	const Vec3 eye{ 0.0, -6.0, 3.0 };
+	for (int j = 0; j < IMAGE_SIZE; j++) {
+		for (int i = 0; i < IMAGE_SIZE; i++) {
+			Ray ray;
+			ray.origin = eye;
+			ray.direction = Vec3{ (i - IMAGE_SIZE / 2) * 4.0 / IMAGE_SIZE, 0.0, (IMAGE_SIZE / 2 - j) * 4.0 / IMAGE_SIZE } - eye;
+			rays.push_back(ray);
+		}
+	}
+
+	// 1. Scalar
+	std::vector<RayHit> hits(rays.size());
+	int hitNum = 0;
+	Benchmark::Timer timer;
+	for (int r = 0; r < REPEAT_NUM; r++) {
+		hitNum = 0;
+		timer.start();
+		for (int i = 0; i < (int)rays.size(); i++) {
+			if (intersect(patch, rays[i], 0.0, maxDouble, hits[i]))
+				hitNum++;
+			else
+				hits[i].t = -1.0;
+		}
+		timer.stop();
+	}
+	printf("Scalar : %.1f ns / ray, %d hits\n", timer.best / rays.size() * 1e9, hitNum);
+
+	// 2. Packets
+	packetBenchmark<4>(patch, hits);
+	packetBenchmark<8>(patch, hits);
+	packetBenchmark<16>(patch, hits);
+	return 0;
+}
\ No newline at end of file
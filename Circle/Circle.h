@@ -122,6 +122,51 @@ namespace MN {
 			maxFpt = evaluate(maxp);
 			return ret;
 		}
+
+		// Batch version of [ findMinDistParam ] and [ findMinDistPoint ] for [ num ] points given in structure of arrays
+		// Closest point does not depend on Z coordinate, so only X, Y coordinates are needed
+		// Loops have no branches and no library calls except [ sqrt ], so that they can be vectorized
+		// @params :	Parameters of the closest points. Points on the axis get parameter 0, same as [ findMinDistParam ]
+		// @cx, cy :	Closest points ( Z coordinate is 0 ), not computed if nullptr
+		inline void findMinDistParams(int num, const Real x[], const Real y[], Real params[], Real cx[] = nullptr, Real cy[] = nullptr) const noexcept {
+			if (cx == nullptr || cy == nullptr) {
+				for (int i = 0; i < num; i++)
+					params[i] = atan2Param(y[i], x[i]);
+				return;
+			}
+			const Real r = radius;		// Kept in register, since it could alias [ cx, cy ]
+			for (int i = 0; i < num; i++) {
+				Real len = sqrt(x[i] * x[i] + y[i] * y[i]);
+				bool onAxis = (len == (Real)0.0);
+				Real scale = r / (onAxis ? (Real)1.0 : len);
+				params[i] = atan2Param(y[i], x[i]);
+				cx[i] = onAxis ? r : x[i] * scale;
+				cy[i] = y[i] * scale;
+			}
+		}
+	protected:
+		// Parameter of direction [ x, y ], which is [ atan2(y, x) ] mapped to [ 0, 2PI ) ( 0 for the origin )
+		// Ratio of smaller to larger coordinate is reduced to [ -0.66, 0.66 ], where rational approximation of Cephes' atan is used
+		// Octant is then restored by selects instead of branches
+		inline static Real atan2Param(Real y, Real x) noexcept {
+			Real
+				ax = fabs(x),
+				ay = fabs(y),
+				hi = (ax > ay) ? ax : ay,
+				lo = (ax > ay) ? ay : ax,
+				r = lo / ((hi > (Real)0.0) ? hi : (Real)1.0);
+			bool big = (r > 0.66);
+			Real
+				v = big ? (r - 1.0) / (r + 1.0) : r,
+				z = v * v,
+				p = (((-8.750608600031904122785e-1 * z - 1.615753718733365076637e1) * z - 7.500855792314704667340e1) * z - 1.228866684490136173410e2) * z - 6.485021904942025371773e1,
+				q = ((((z + 2.485846490142306297962e1) * z + 1.650270098316988542046e2) * z + 4.328810604912902668951e2) * z + 4.853903996359136964868e2) * z + 1.945506571482613964425e2,
+				t = v + v * z * p / q;
+			t += big ? (PI05 * 0.5 + 3.061616997868382943065e-17) : 0.0;
+			t = (ay > ax) ? PI05 - t : t;
+			t = (x < 0) ? PI - t : t;
+			return (y < 0) ? PI20 - t : t;
+		}
 	};
 
 	// Circular Arc on XY plane
@@ -226,6 +271,59 @@ namespace MN {
 				return 0;
 			}
 		}
+
+		// Batch version of [ findMinDistParam ] and [ findMinDistPoint ] for [ num ] points, see [ Circle::findMinDistParams ]
+		// If the closest point on the full circle is out of domain, the closer end point is chosen by selects instead of branches
+		// Points on the axis get [ domain.middle() ], same as [ findMinDistParam ]
+		inline void findMinDistParams(int num, const Real x[], const Real y[], Real params[], Real cx[] = nullptr, Real cy[] = nullptr) const noexcept {
+			const Real
+				width = domain.width(),
+				beg = domain.beg(),
+				end = domain.end(),
+				mid = domain.middle(),
+				regBeg = piDomain::regularize(beg),
+				r = radius;
+			const Vec3
+				begPt = evaluate(beg),
+				endPt = evaluate(end),
+				midPt = evaluate(mid);
+			if (cx == nullptr || cy == nullptr) {
+				for (int i = 0; i < num; i++) {
+					Real
+						px = x[i],
+						py = y[i],
+						param = atan2Param(py, px),
+						offset = param - regBeg;
+					offset += (offset < 0) ? PI20 : 0.0;
+					bool
+						onAxis = (px == (Real)0.0) & (py == (Real)0.0),
+						inside = (offset <= width),
+						closerBeg = (px * begPt[0] + py * begPt[1] > px * endPt[0] + py * endPt[1]);
+					params[i] = onAxis ? mid : (inside ? param : (closerBeg ? beg : end));
+				}
+				return;
+			}
+			for (int i = 0; i < num; i++) {
+				Real
+					px = x[i],
+					py = y[i],
+					len = sqrt(px * px + py * py),
+					param = atan2Param(py, px),
+					offset = param - regBeg;
+				offset += (offset < 0) ? PI20 : 0.0;
+				bool
+					onAxis = (len == (Real)0.0),
+					inside = (offset <= width),
+					closerBeg = (px * begPt[0] + py * begPt[1] > px * endPt[0] + py * endPt[1]);
+				Real
+					scale = r / (onAxis ? (Real)1.0 : len),
+					bx = closerBeg ? begPt[0] : endPt[0],
+					by = closerBeg ? begPt[1] : endPt[1];
+				params[i] = onAxis ? mid : (inside ? param : (closerBeg ? beg : end));
+				cx[i] = onAxis ? midPt[0] : (inside ? px * scale : bx);
+				cy[i] = onAxis ? midPt[1] : (inside ? py * scale : by);
+			}
+		}
 	};
 }
 
@@ -9,47 +9,200 @@
 #include "CircleBinormal.h"
 #include "CircleIntersect.h"
 //#include "../Binomial.h"
+#include <algorithm>
 
 #define ROOT_EPS				1e-10		// [ x ] must satisfy |f(x)| <= ROOT_EPS to be root  
 #define TOL						1e-5		// Epsilon for numerical stability : Search domain [ -1, 1 ] is extended by this
 #define DOMAIN_EPS				1e-3		// Maximum domain width to find a single root ( If multiple roots coexist in the domain narrower than this, only one of them would be found )
+#define SUBDIVISION_RATIO		0.125		// Subdivision point is clamped into [ SUBDIVISION_RATIO, 1 - SUBDIVISION_RATIO ], so that every subdivision shrinks domain
 #define NR_MAX_ITER				20			// Maximum step to take when doing numerical search
 #define PROJECTION_EPS			1e-1		// Tolerance when projecting point from a circular arc to the other circular arc ( for stability )
 #define BINORMAL_LUDCMP_EPS		1.0e-20		// EPS for LU Decomposition in binormal routine
 #define PROXIMITY_EPS			1e-10		// Two points are considered to be same if distance between them is lower than this value
 #define PROXIMITY_EPS2			1e-5		// Two points are close enough to make binormal objective function value unstable
+#define BISECTION_EPS			1e-14		// Bisection stops when bracket gets narrower than this
+#define COMPANION_IMAG_EPS		1e-6		// Eigenvalue of companion matrix is regarded as real root if its imaginary part is smaller than this
+#define STURM_EPS				1e-12		// Relative size of remainder coefficient regarded as zero in Sturm sequence
+#define BRUTE_CHUNK				64			// Number of samples processed at once in brute solve
+#define BRUTE_NR_FILTER			1.0			// Brute solve runs NR only from starting parameters where |fvec[1]| + |fvec[2]| is smaller than this
+
+#ifdef MN_BINORMAL_STATS
+#define BINORMAL_STATS(counter)	(CircleBinormal::stats().counter++)
+#define BINORMAL_STATS_ADD(counter, num)	(CircleBinormal::stats().counter += (num))
+#else
+#define BINORMAL_STATS(counter)	((void)0)
+#define BINORMAL_STATS_ADD(counter, num)	((void)0)
+#endif
 
 namespace MN {
-	static const Binomial oBin = Binomial::create(8);
-	static const Real binomial[9][9] = {
-		{ oBin.at(0, 0) },
-		{ oBin.at(1, 0), oBin.at(1, 1) },
-		{ oBin.at(2, 0), oBin.at(2, 1), oBin.at(2, 2) },
-		{ oBin.at(3, 0), oBin.at(3, 1), oBin.at(3, 2), oBin.at(3, 3) },
-		{ oBin.at(4, 0), oBin.at(4, 1), oBin.at(4, 2), oBin.at(4, 3), oBin.at(4, 4) },
-		{ oBin.at(5, 0), oBin.at(5, 1), oBin.at(5, 2), oBin.at(5, 3), oBin.at(5, 4), oBin.at(5, 5) },
-		{ oBin.at(6, 0), oBin.at(6, 1), oBin.at(6, 2), oBin.at(6, 3), oBin.at(6, 4), oBin.at(6, 5), oBin.at(6, 6) },
-		{ oBin.at(7, 0), oBin.at(7, 1), oBin.at(7, 2), oBin.at(7, 3), oBin.at(7, 4), oBin.at(7, 5), oBin.at(7, 6), oBin.at(7, 7) },
-		{ oBin.at(8, 0), oBin.at(8, 1), oBin.at(8, 2), oBin.at(8, 3), oBin.at(8, 4), oBin.at(8, 5), oBin.at(8, 6), oBin.at(8, 7), oBin.at(8, 8) }
+	// Binomial coefficients up to degree 8, known at compile time so that degree-specialized kernels can fold them
+	static constexpr Real binomial[9][9] = {
+		{ 1 },
+		{ 1, 1 },
+		{ 1, 2, 1 },
+		{ 1, 3, 3, 1 },
+		{ 1, 4, 6, 4, 1 },
+		{ 1, 5, 10, 10, 5, 1 },
+		{ 1, 6, 15, 20, 15, 6, 1 },
+		{ 1, 7, 21, 35, 35, 21, 7, 1 },
+		{ 1, 8, 28, 56, 70, 56, 28, 8, 1 }
 	};
 
+	// Worst case depth of Bezier subdivision : Every subdivision without root shrinks domain at least by ( 1 - SUBDIVISION_RATIO ) until it gets narrower than DOMAIN_EPS,
+	// and every subdivision at a root lowers degree of both halves, which happens at most 8 times along a path
+	static constexpr int maxSubdivisionDepth() {
+		int depth = 8;
+		Real width = 1.0;
+		while (width >= DOMAIN_EPS) {
+			width *= 1.0 - SUBDIVISION_RATIO;
+			depth++;
+		}
+		return depth;
+	}
+	// Stack holds one pending domain per level, and two more slots are needed to subdivide the top
+	static_assert(CircleBinormal::Workspace::bpCapacity >= maxSubdivisionDepth() + 3, "Workspace is too small for DOMAIN_EPS");
+
+	CircleBinormal::Stats& CircleBinormal::stats() noexcept {
+		thread_local Stats threadStats;
+		return threadStats;
+	}
+
 	// BP
+	// Every kernel below is specialized for [ Degree ], so that loops have fixed trip counts and are fully unrolled
+	// Since degree of BP decreases by factoring, runtime versions dispatch on current degree
+	template<int Degree>
 	inline static void subdivideBP(const CircleBinormal::BP& M, Real t, CircleBinormal::BP& L, CircleBinormal::BP& R) {
-		Real iCoefs[9];
-		memcpy(iCoefs, M.coefs, sizeof(Real) * (M.degree + 1));
-		L.degree = M.degree;
-		R.degree = M.degree;
+		Real iCoefs[Degree + 1];
+		for (int i = 0; i <= Degree; i++)
+			iCoefs[i] = M.coefs[i];
+		L.degree = Degree;
+		R.degree = Degree;
 
-		int cnt = 0;
-		int degree = M.degree;
 		Real t_1 = 1.0 - t;
-		do {
+		for (int cnt = 0; cnt <= Degree; cnt++) {
 			L.coefs[cnt] = iCoefs[0];
-			R.coefs[degree - cnt] = iCoefs[degree - cnt];
+			R.coefs[Degree - cnt] = iCoefs[Degree - cnt];
 
-			for (int i = 0; i < degree - cnt; i++)
+			for (int i = 0; i < Degree - cnt; i++)
 				iCoefs[i] = t_1 * iCoefs[i] + t * iCoefs[i + 1];
-		} while (cnt++ < degree);
+		}
+	}
+	template<int Degree>
+	inline static void factorBP(CircleBinormal::BP& M, bool atZero) {
+		if (atZero) {
+			for (int i = 0; i < Degree; i++)
+				M.coefs[i] = M.coefs[i + 1] * (Degree / (Real)(i + 1));
+		}
+		else {
+			for (int i = 0; i < Degree; i++)
+				M.coefs[i] = M.coefs[i] * (Degree / (Real)(Degree - i));
+		}
+		M.degree = Degree - 1;
+	}
+	template<int Degree>
+	inline static void setDcoefsBP(CircleBinormal::BP& M) {
+		for (int i = 0; i < Degree; i++)
+			M.dCoefs[i] = M.coefs[i + 1] - M.coefs[i];
+	}
+	template<int Degree>
+	inline static void evaluateBP(const CircleBinormal::BP& M, Real t, Real& value, Real& deriv) {
+		Real t_1 = 1.0 - t;
+		Real memA[Degree + 1];
+		Real memB[Degree + 1];
+		memA[0] = 1.0;
+		memB[0] = 1.0;
+		for (int i = 1; i <= Degree; i++) {
+			memA[i] = memA[i - 1] * t_1;	// (1-t)^0, (1-t)^1, (1-t)^2, ... , (1-t)^degree
+			memB[i] = memB[i - 1] * t;		// t^0, t^1, t^2, ... , t^degree
+		}
+		value = 0.0;
+		deriv = 0.0;
+		for (int i = 0; i <= Degree; i++)
+			value += M.coefs[i] * binomial[Degree][i] * memA[Degree - i] * memB[i];
+		for (int i = 0; i < Degree; i++)
+			deriv += M.dCoefs[i] * binomial[Degree - 1][i] * memA[Degree - 1 - i] * memB[i];
+		deriv *= Degree;
+	}
+	template<int Degree>
+	inline static bool solveNR(const CircleBinormal::BP& M, Real& t) {
+		Real value, deriv, dt;
+		for (int i = 0; i < NR_MAX_ITER; i++) {
+			BINORMAL_STATS(solveNRIterNum);
+			evaluateBP<Degree>(M, t, value, deriv);
+			if (fabs(value) < ROOT_EPS) return true;		// Found root
+			if (deriv == 0.0) break;			// Divergent step
+			dt = value / deriv;
+			t -= dt;
+			if (t < 0 || t > 1) break;			// Out of domain
+		}
+		BINORMAL_STATS(solveNRFailNum);
+		return false;							// Max iteration
+	}
+	inline static void subdivideBP(const CircleBinormal::BP& M, Real t, CircleBinormal::BP& L, CircleBinormal::BP& R) {
+		BINORMAL_STATS(subdivisionNum);
+		switch (M.degree) {
+		case 1: subdivideBP<1>(M, t, L, R); break;
+		case 2: subdivideBP<2>(M, t, L, R); break;
+		case 3: subdivideBP<3>(M, t, L, R); break;
+		case 4: subdivideBP<4>(M, t, L, R); break;
+		case 5: subdivideBP<5>(M, t, L, R); break;
+		case 6: subdivideBP<6>(M, t, L, R); break;
+		case 7: subdivideBP<7>(M, t, L, R); break;
+		case 8: subdivideBP<8>(M, t, L, R); break;
+		default: subdivideBP<0>(M, t, L, R); break;
+		}
+	}
+	inline static void factorBP(CircleBinormal::BP& M, bool atZero) {
+		switch (M.degree) {
+		case 1: factorBP<1>(M, atZero); break;
+		case 2: factorBP<2>(M, atZero); break;
+		case 3: factorBP<3>(M, atZero); break;
+		case 4: factorBP<4>(M, atZero); break;
+		case 5: factorBP<5>(M, atZero); break;
+		case 6: factorBP<6>(M, atZero); break;
+		case 7: factorBP<7>(M, atZero); break;
+		case 8: factorBP<8>(M, atZero); break;
+		default: M.degree--; break;
+		}
+	}
+	inline static void setDcoefsBP(CircleBinormal::BP& M) {
+		switch (M.degree) {
+		case 1: setDcoefsBP<1>(M); break;
+		case 2: setDcoefsBP<2>(M); break;
+		case 3: setDcoefsBP<3>(M); break;
+		case 4: setDcoefsBP<4>(M); break;
+		case 5: setDcoefsBP<5>(M); break;
+		case 6: setDcoefsBP<6>(M); break;
+		case 7: setDcoefsBP<7>(M); break;
+		case 8: setDcoefsBP<8>(M); break;
+		default: break;
+		}
+	}
+	inline static void evaluateBP(const CircleBinormal::BP& M, Real t, Real& value, Real& deriv) {
+		switch (M.degree) {
+		case 1: evaluateBP<1>(M, t, value, deriv); break;
+		case 2: evaluateBP<2>(M, t, value, deriv); break;
+		case 3: evaluateBP<3>(M, t, value, deriv); break;
+		case 4: evaluateBP<4>(M, t, value, deriv); break;
+		case 5: evaluateBP<5>(M, t, value, deriv); break;
+		case 6: evaluateBP<6>(M, t, value, deriv); break;
+		case 7: evaluateBP<7>(M, t, value, deriv); break;
+		case 8: evaluateBP<8>(M, t, value, deriv); break;
+		default: value = M.coefs[0]; deriv = 0.0; break;
+		}
+	}
+	inline static bool solveNR(const CircleBinormal::BP& M, Real& t) {
+		switch (M.degree) {
+		case 1: return solveNR<1>(M, t);
+		case 2: return solveNR<2>(M, t);
+		case 3: return solveNR<3>(M, t);
+		case 4: return solveNR<4>(M, t);
+		case 5: return solveNR<5>(M, t);
+		case 6: return solveNR<6>(M, t);
+		case 7: return solveNR<7>(M, t);
+		case 8: return solveNR<8>(M, t);
+		default: return false;
+		}
 	}
 	inline static bool purgeBP(const CircleBinormal::BP& M, Real validDomain[2]) {
 		// Check if M's domain meets [ validDomain ]
@@ -65,11 +218,12 @@ namespace MN {
 		}
 		return true;
 	}
-	inline static bool purgeBP(const CircleBinormal::BP& M, const std::vector<Domain>& validDomains) {
+	inline static bool purgeBP(const CircleBinormal::BP& M, const Domain validDomains[], int validDomainNum) {
 		// Check if M's domain meets [ validDomains ]
 		// If not, purge it
 		bool inDomain = false;
-		for (auto& domain : validDomains) {
+		for (int i = 0; i < validDomainNum; i++) {
+			const Domain& domain = validDomains[i];
 			if (M.domain[1] >= domain.beg() && M.domain[0] <= domain.end()) {
 				inDomain = true;
 				break;
@@ -86,45 +240,6 @@ namespace MN {
 		}
 		return true;
 	}
-	inline static void factorBP(CircleBinormal::BP& M, bool atZero) {
-		for (int i = 0; i < M.degree; i++) {
-			M.coefs[i] = atZero ?
-				M.coefs[i + 1] * (M.degree / (Real)(i + 1)) :
-				M.coefs[i] * (M.degree / (Real)(M.degree - i));
-		}
-		M.degree--;
-	}
-	inline static void evaluateBP(const CircleBinormal::BP& M, Real t, Real& value, Real& deriv) {
-		Real t_1 = 1.0 - t;
-		Real memA[9];
-		Real memB[9];
-		memA[0] = 1.0;
-		memB[0] = 1.0;
-		for (int i = 1; i <= M.degree; i++) {
-			memA[i] = memA[i - 1] * t_1;	// (1-t)^0, (1-t)^1, (1-t)^2, ... , (1-t)^degree
-			memB[i] = memB[i - 1] * t;		// t^0, t^1, t^2, ... , t^degree
-		}
-		value = 0.0;
-		deriv = 0.0;
-		for (int i = 0; i <= M.degree; i++) {
-			value += M.coefs[i] * binomial[M.degree][i] * memA[M.degree - i] * memB[i];
-			if (i < M.degree)
-				deriv += M.dCoefs[i] * binomial[M.degree - 1][i] * memA[M.degree - 1 - i] * memB[i];
-		}
-		deriv *= M.degree;
-	}
-	inline static bool solveNR(const CircleBinormal::BP& M, Real& t) {
-		Real value, deriv, dt;
-		for (int i = 0; i < NR_MAX_ITER; i++) {
-			evaluateBP(M, t, value, deriv);
-			if (fabs(value) < ROOT_EPS) return true;		// Found root
-			if (deriv == 0.0) return false;		// Divergent step
-			dt = value / deriv;
-			t -= dt;
-			if (t < 0 || t > 1) return false;	// Out of domain
-		}
-		return false;							// Max iteration
-	}
 	inline static Real estimateBP(const CircleBinormal::BP& M) {
 		Real length = (1.0 / M.degree);
 		Real t = 0;
@@ -137,7 +252,7 @@ namespace MN {
 		}
 		return 0.5;
 	}
-	CircleBinormal::BP CircleBinormal::initBP(const Real monoCoefs[9], const std::vector<Domain>& domains) {
+	CircleBinormal::BP CircleBinormal::initBP(const Real monoCoefs[9], const Domain domains[], int domainNum, Domain validDomains[]) {
 		BP bp;
 		// 1. Reparametrize monomial to [0, 1] 
 		// Since cosine value spans [-1, 1], we have to shrink it into [0, 1]
@@ -169,11 +284,10 @@ namespace MN {
 		// If we want to find root only in [ a, b ], in the following process, we can only search for [ 0.5a + 0.5, 0.5b + 0.5 ]
 		const static Real Q1 = 1.0 / Q0;	// 0.5	
 		const static Real P1 = P0 * Q1;		// -0.5
-		validDomains = domains;
-		for (auto& domain : validDomains) {
-			Real nbeg = Q1 * (domain.beg() - TOL - P0);
-			Real nend = Q1 * (domain.end() + TOL - P0);
-			domain.set(nbeg, nend);
+		for (int i = 0; i < domainNum; i++) {
+			Real nbeg = Q1 * (domains[i].beg() - TOL - P0);
+			Real nend = Q1 * (domains[i].end() + TOL - P0);
+			validDomains[i].set(nbeg, nend);
 		}
 
 		bp.degree = 8;
@@ -181,25 +295,124 @@ namespace MN {
 		bp.domain[1] = 1;
 		return bp;
 	}
-	void CircleBinormal::solveBP(const Real monoCoefs[9], const std::vector<Domain>& domains, Real roots[], int& rootNum) {
-		// Allocate storage for [ data ]
-		static const int dataSize = (int)(1.0 / DOMAIN_EPS) + 1;
-		if (data.size() < dataSize)
-			data.resize(dataSize);
+	// Push [ root ] unless [ roots ] is already full, so that degenerate polynomials cannot report more than [ maxRootNum ] roots
+	inline static void pushRootBP(Real roots[], int& rootNum, Real root) {
+		if (rootNum < CircleBinormal::maxRootNum)
+			roots[rootNum++] = root;
+	}
+	// Factor out roots at both ends of [ M ], before iteration
+	inline static void factorEndsBP(CircleBinormal::BP& M, Real roots[], int& rootNum) {
+		if (M.degree > 0 && fabs(M.coefs[0]) < ROOT_EPS) {
+			pushRootBP(roots, rootNum, 0.0);
+			while (M.degree > 0 && fabs(M.coefs[0]) < ROOT_EPS)
+				factorBP(M, true);
+		}
+		if (M.degree > 0 && fabs(M.coefs[M.degree]) < ROOT_EPS) {
+			pushRootBP(roots, rootNum, 1.0);
+			while (M.degree > 0 && fabs(M.coefs[M.degree]) < ROOT_EPS)
+				factorBP(M, false);
+		}
+	}
+	// Subdivide top of the stack [ data[idx] ] with the result of NR
+	// @found :		True if NR converged to [ nrRoot ]
+	// @nrRootCopy : Initial guess of NR, used as subdivision point if NR failed
+	inline static void subdivideStackBP(CircleBinormal::BP data[], int& idx, bool found, Real nrRoot, Real nrRootCopy, Real roots[], int& rootNum) {
+		Real domWidth = data[idx].domain[1] - data[idx].domain[0];
+		if (found) {
+			subdivideBP(data[idx], nrRoot, data[idx + 1], data[idx + 2]);
+			do {
+				factorBP(data[idx + 1], false);
+				factorBP(data[idx + 2], true);
+			} while (fabs(data[idx + 2].coefs[0]) < ROOT_EPS && data[idx + 2].degree > 0);
+
+			Real root = data[idx].domain[0] + domWidth * nrRoot;
+			pushRootBP(roots, rootNum, root);
+			if (data[idx + 1].degree > 0) {
+				data[idx + 1].domain[0] = data[idx].domain[0];
+				data[idx + 1].domain[1] = root;
+				data[idx + 2].domain[0] = root;
+				data[idx + 2].domain[1] = data[idx].domain[1];
 
-		// Before iteration, factor as much as we can
-		BP m = initBP(monoCoefs, domains);
-		rootNum = 0;
-		if (m.degree > 0 && fabs(m.coefs[0]) < ROOT_EPS) {
-			roots[rootNum++] = 0.0;
-			while (m.degree > 0 && fabs(m.coefs[0]) < ROOT_EPS)
-				factorBP(m, true);
+				data[idx] = data[idx + 1];
+				data[idx + 1] = data[idx + 2];
+				idx++;
+			}
+			else
+				idx--;
+		}
+		else {
+			if (domWidth < DOMAIN_EPS) {
+				BINORMAL_STATS(domainEpsRootNum);
+				pushRootBP(roots, rootNum, data[idx].domain[0] + domWidth * 0.5); // Since we do NR later, just push it
+				idx--;
+				return;
+			}
+			if (nrRootCopy > 1 - SUBDIVISION_RATIO)
+				nrRootCopy = 1 - SUBDIVISION_RATIO;
+			else if (nrRootCopy < SUBDIVISION_RATIO)
+				nrRootCopy = SUBDIVISION_RATIO;
+
+			subdivideBP(data[idx], nrRootCopy, data[idx + 1], data[idx + 2]);
+			Real domMid = data[idx].domain[0] + domWidth * nrRootCopy;
+
+			data[idx + 1].domain[0] = data[idx].domain[0];
+			data[idx + 1].domain[1] = domMid;
+			data[idx + 2].domain[0] = domMid;
+			data[idx + 2].domain[1] = data[idx].domain[1];
+
+			data[idx] = data[idx + 1];
+			data[idx + 1] = data[idx + 2];
+			idx++;
+		}
+	}
+	// Pop domains from the stack until we meet the one that needs NR
+	// @ret : False if stack became empty
+	inline static bool popStackBP(CircleBinormal::BP data[], int& idx, const Domain validDomains[], int validDomainNum, Real roots[], int& rootNum) {
+		while (idx >= 0) {
+			if (purgeBP(data[idx], validDomains, validDomainNum)) {
+				BINORMAL_STATS(purgeNum);
+				idx--;
+				continue;
+			}
+			if (idx + 2 >= CircleBinormal::Workspace::bpCapacity) {
+				// Cannot happen within [ maxSubdivisionDepth ], but if it does, regard this domain as a single root ( refined by NR later )
+				pushRootBP(roots, rootNum, (data[idx].domain[0] + data[idx].domain[1]) * 0.5);
+				idx--;
+				continue;
+			}
+			return true;
 		}
-		if (m.degree > 0 && fabs(m.coefs[m.degree]) < ROOT_EPS) {
-			roots[rootNum++] = 1.0;
-			while (m.degree > 0 && fabs(m.coefs[m.degree]) < ROOT_EPS)
-				factorBP(m, false);
+		return false;
+	}
+	// Change root to original domain ( inverse of reparametrization in [ initBP ] )
+	inline static Real recoverRootBP(Real root) {
+		return root * 2.0 * (1 + TOL) - (1 + TOL);
+	}
+	inline static void recoverRootsBP(Real roots[], int rootNum) {
+		for (int i = 0; i < rootNum; i++)
+			roots[i] = recoverRootBP(roots[i]);
+	}
+	void CircleBinormal::solveBP(const Real monoCoefs[9], const Domain domains[], int domainNum, Real roots[], int& rootNum, Workspace& ws) {
+		switch (ws.rootSolver) {
+		case RootSolver::Descartes:
+			solveBPDescartes(monoCoefs, domains, domainNum, roots, rootNum, ws);
+			break;
+		case RootSolver::Companion:
+			solveBPCompanion(monoCoefs, domains, domainNum, roots, rootNum, ws);
+			break;
+		default:
+			solveBPBezier(monoCoefs, domains, domainNum, roots, rootNum, ws);
+			break;
 		}
+	}
+	void CircleBinormal::solveBPBezier(const Real monoCoefs[9], const Domain domains[], int domainNum, Real roots[], int& rootNum, Workspace& ws) {
+		BP* data = ws.data;
+
+		// Before iteration, factor as much as we can
+		BP m = initBP(monoCoefs, domains, domainNum, ws.validDomains);
+		ws.validDomainNum = domainNum;
+		rootNum = 0;
+		factorEndsBP(m, roots, rootNum);
 
 		if (m.degree == 0)
 			return;
@@ -207,68 +420,463 @@ namespace MN {
 		// Iterative search
 		int idx = 0;
 		data[idx] = m;
-		while (idx >= 0) {
-			if (purgeBP(data[idx], validDomains)) {
-				idx--;
-				continue;
-			}
+		while (popStackBP(data, idx, ws.validDomains, ws.validDomainNum, roots, rootNum)) {
 			Real nrRoot = estimateBP(data[idx]);
 			Real nrRootCopy = nrRoot;
-			Real domWidth = data[idx].domain[1] - data[idx].domain[0];
-
-			data[idx].setDcoefs();	// Have to get ready derivative coefficients before NR
-			if (solveNR(data[idx], nrRoot)) {
-				subdivideBP(data[idx], nrRoot, data[idx + 1], data[idx + 2]);
-				do {
-					factorBP(data[idx + 1], false);
-					factorBP(data[idx + 2], true);
-				} while (fabs(data[idx + 2].coefs[0]) < ROOT_EPS && data[idx + 2].degree > 0);
-
-				Real root = data[idx].domain[0] + domWidth * nrRoot;
-				roots[rootNum++] = root;
-				if (data[idx + 1].degree > 0) {
-					data[idx + 1].domain[0] = data[idx].domain[0];
-					data[idx + 1].domain[1] = root;
-					data[idx + 2].domain[0] = root;
-					data[idx + 2].domain[1] = data[idx].domain[1];
-
-					data[idx] = data[idx + 1];
-					data[idx + 1] = data[idx + 2];
-					idx++;
-				}
-				else
+
+			setDcoefsBP(data[idx]);	// Have to get ready derivative coefficients before NR
+			bool found = solveNR(data[idx], nrRoot);
+			subdivideStackBP(data, idx, found, nrRoot, nrRootCopy, roots, rootNum);
+		}
+
+		recoverRootsBP(roots, rootNum);
+	}
+	// Descartes
+	// Number of sign variations in Bezier coefficients, which is an upper bound of the number of roots in the domain
+	inline static int signVariationBP(const CircleBinormal::BP& M) {
+		int var = 0;
+		Real prev = 0.0;
+		for (int i = 0; i <= M.degree; i++) {
+			if (M.coefs[i] == 0.0)
+				continue;
+			if (prev * M.coefs[i] < 0)
+				var++;
+			prev = M.coefs[i];
+		}
+		return var;
+	}
+	// Find the single root of [ M ] in its domain by bisection
+	// @ret : Root in [ 0, 1 ], relative to the domain of [ M ]
+	inline static Real bisectBP(CircleBinormal::BP& M) {
+		Real lo = 0.0, hi = 1.0, mid = 0.5, value, deriv;
+		bool loPositive = M.coefs[0] > 0;
+		Real domWidth = M.domain[1] - M.domain[0];
+
+		setDcoefsBP(M);
+		while ((hi - lo) * domWidth > BISECTION_EPS) {
+			mid = (lo + hi) * 0.5;
+			evaluateBP(M, mid, value, deriv);
+			if (fabs(value) < ROOT_EPS)
+				break;
+			if ((value > 0) == loPositive) lo = mid;
+			else hi = mid;
+		}
+		return mid;
+	}
+	void CircleBinormal::solveBPDescartes(const Real monoCoefs[9], const Domain domains[], int domainNum, Real roots[], int& rootNum, Workspace& ws) {
+		BP* data = ws.data;
+
+		// Before iteration, factor as much as we can
+		BP m = initBP(monoCoefs, domains, domainNum, ws.validDomains);
+		ws.validDomainNum = domainNum;
+		rootNum = 0;
+		factorEndsBP(m, roots, rootNum);
+
+		if (m.degree == 0)
+			return;
+
+		// Iterative search : Halve domains until each of them has at most one sign variation
+		int idx = 0;
+		data[idx] = m;
+		while (popStackBP(data, idx, ws.validDomains, ws.validDomainNum, roots, rootNum)) {
+			BP& top = data[idx];
+			Real domWidth = top.domain[1] - top.domain[0];
+
+			// Subdivision point could have been a root
+			if (fabs(top.coefs[0]) < ROOT_EPS || fabs(top.coefs[top.degree]) < ROOT_EPS) {
+				int prevRootNum = rootNum;
+				factorEndsBP(top, roots, rootNum);
+				for (int i = prevRootNum; i < rootNum; i++)
+					roots[i] = top.domain[0] + domWidth * roots[i];
+				if (top.degree == 0)
 					idx--;
 				continue;
 			}
-			else {
-				if (domWidth < DOMAIN_EPS) {
-					roots[rootNum++] = data[idx].domain[0] + domWidth * 0.5; // Since we do NR later, just push it
-					idx--;
-					continue;
+
+			int var = signVariationBP(top);
+			if (var == 1) {
+				pushRootBP(roots, rootNum, top.domain[0] + domWidth * bisectBP(top));
+				idx--;
+			}
+			else if (domWidth < DOMAIN_EPS) {
+				BINORMAL_STATS(domainEpsRootNum);
+				pushRootBP(roots, rootNum, top.domain[0] + domWidth * 0.5); // Since we do NR later, just push it
+				idx--;
+			}
+			else
+				subdivideStackBP(data, idx, false, 0.5, 0.5, roots, rootNum);
+		}
+
+		recoverRootsBP(roots, rootNum);
+	}
+
+	// Companion
+	// Balance matrix [ a ] to make eigenvalues less sensitive to rounding error ( Numerical Recipes, balanc )
+	inline static void companionBalance(Real a[9][9], int n) {
+		const static Real RADIX = 2.0;
+		const static Real sqrdx = RADIX * RADIX;
+		int last, i, j;
+		Real s, r, g, f, c;
+
+		last = 0;
+		while (last == 0) {
+			last = 1;
+			for (i = 1; i <= n; i++) {
+				r = c = 0.0;
+				for (j = 1; j <= n; j++)
+					if (j != i) {
+						c += fabs(a[j][i]);
+						r += fabs(a[i][j]);
+					}
+				if (c != 0.0 && r != 0.0) {
+					g = r / RADIX;
+					f = 1.0;
+					s = c + r;
+					while (c < g) {
+						f *= RADIX;
+						c *= sqrdx;
+					}
+					g = r * RADIX;
+					while (c > g) {
+						f /= RADIX;
+						c /= sqrdx;
+					}
+					if ((c + r) / f < 0.95 * s) {
+						last = 0;
+						g = 1.0 / f;
+						for (j = 1; j <= n; j++) a[i][j] *= g;
+						for (j = 1; j <= n; j++) a[j][i] *= f;
+					}
+				}
+			}
+		}
+	}
+	// Find eigenvalues ( wr + i * wi ) of upper Hessenberg matrix [ a ] by QR algorithm ( Numerical Recipes, hqr )
+	// @ret : False if QR iteration did not converge
+	inline static bool companionHQR(Real a[9][9], int n, Real wr[9], Real wi[9]) {
+		int nn, m, l, k, j, its, i, mmin;
+		Real z, y, x, w, v, u, t, s, r, q, p, anorm;
+
+		p = q = r = 0.0;
+		anorm = 0.0;
+		for (i = 1; i <= n; i++)
+			for (j = (i - 1 > 1 ? i - 1 : 1); j <= n; j++)
+				anorm += fabs(a[i][j]);
+		nn = n;
+		t = 0.0;
+		while (nn >= 1) {
+			its = 0;
+			do {
+				for (l = nn; l >= 2; l--) {
+					s = fabs(a[l - 1][l - 1]) + fabs(a[l][l]);
+					if (s == 0.0) s = anorm;
+					if ((Real)(fabs(a[l][l - 1]) + s) == s) {
+						a[l][l - 1] = 0.0;
+						break;
+					}
+				}
+				x = a[nn][nn];
+				if (l == nn) {
+					wr[nn] = x + t;
+					wi[nn--] = 0.0;
+				}
+				else {
+					y = a[nn - 1][nn - 1];
+					w = a[nn][nn - 1] * a[nn - 1][nn];
+					if (l == (nn - 1)) {
+						p = 0.5 * (y - x);
+						q = p * p + w;
+						z = sqrt(fabs(q));
+						x += t;
+						if (q >= 0.0) {
+							z = p + (p >= 0.0 ? fabs(z) : -fabs(z));
+							wr[nn - 1] = wr[nn] = x + z;
+							if (z != 0.0) wr[nn] = x - w / z;
+							wi[nn - 1] = wi[nn] = 0.0;
+						}
+						else {
+							wr[nn - 1] = wr[nn] = x + p;
+							wi[nn - 1] = -(wi[nn] = z);
+						}
+						nn -= 2;
+					}
+					else {
+						if (its == 30)
+							return false;
+						if (its == 10 || its == 20) {
+							t += x;
+							for (i = 1; i <= nn; i++) a[i][i] -= x;
+							s = fabs(a[nn][nn - 1]) + fabs(a[nn - 1][nn - 2]);
+							y = x = 0.75 * s;
+							w = -0.4375 * s * s;
+						}
+						++its;
+						for (m = nn - 2; m >= l; m--) {
+							z = a[m][m];
+							r = x - z;
+							s = y - z;
+							p = (r * s - w) / a[m + 1][m] + a[m][m + 1];
+							q = a[m + 1][m + 1] - z - r - s;
+							r = a[m + 2][m + 1];
+							s = fabs(p) + fabs(q) + fabs(r);
+							p /= s;
+							q /= s;
+							r /= s;
+							if (m == l) break;
+							u = fabs(a[m][m - 1]) * (fabs(q) + fabs(r));
+							v = fabs(p) * (fabs(a[m - 1][m - 1]) + fabs(z) + fabs(a[m + 1][m + 1]));
+							if ((Real)(u + v) == v) break;
+						}
+						for (i = m + 2; i <= nn; i++) {
+							a[i][i - 2] = 0.0;
+							if (i != (m + 2)) a[i][i - 3] = 0.0;
+						}
+						for (k = m; k <= nn - 1; k++) {
+							if (k != m) {
+								p = a[k][k - 1];
+								q = a[k + 1][k - 1];
+								r = 0.0;
+								if (k != (nn - 1)) r = a[k + 2][k - 1];
+								if ((x = fabs(p) + fabs(q) + fabs(r)) != 0.0) {
+									p /= x;
+									q /= x;
+									r /= x;
+								}
+							}
+							s = sqrt(p * p + q * q + r * r);
+							if (p < 0.0) s = -s;
+							if (s != 0.0) {
+								if (k == m) {
+									if (l != m)
+										a[k][k - 1] = -a[k][k - 1];
+								}
+								else
+									a[k][k - 1] = -s * x;
+								p += s;
+								x = p / s;
+								y = q / s;
+								z = r / s;
+								q /= p;
+								r /= p;
+								for (j = k; j <= nn; j++) {
+									p = a[k][j] + q * a[k + 1][j];
+									if (k != (nn - 1)) {
+										p += r * a[k + 2][j];
+										a[k + 2][j] -= p * z;
+									}
+									a[k + 1][j] -= p * y;
+									a[k][j] -= p * x;
+								}
+								mmin = nn < k + 3 ? nn : k + 3;
+								for (i = l; i <= mmin; i++) {
+									p = x * a[i][k] + y * a[i][k + 1];
+									if (k != (nn - 1)) {
+										p += z * a[i][k + 2];
+										a[i][k + 2] -= p * r;
+									}
+									a[i][k + 1] -= p * q;
+									a[i][k] -= p;
+								}
+							}
+						}
+					}
 				}
-				if (nrRootCopy > 1 - DOMAIN_EPS)
-					nrRootCopy = 1 - DOMAIN_EPS;
-				else if (nrRootCopy < DOMAIN_EPS)
-					nrRootCopy = DOMAIN_EPS;
+			} while (l < nn - 1);
+		}
+		return true;
+	}
+	void CircleBinormal::solveBPCompanion(const Real monoCoefs[9], const Domain domains[], int domainNum, Real roots[], int& rootNum, Workspace& ws) {
+		rootNum = 0;
 
-				subdivideBP(data[idx], nrRootCopy, data[idx + 1], data[idx + 2]);
-				Real domMid = data[idx].domain[0] + domWidth * nrRootCopy;
+		// Leading coefficients that vanish reduce degree of polynomial
+		int degree = 8;
+		while (degree > 0 && fabs(monoCoefs[degree]) < ROOT_EPS)
+			degree--;
+		if (degree == 0)
+			return;
 
-				data[idx + 1].domain[0] = data[idx].domain[0];
-				data[idx + 1].domain[1] = domMid;
-				data[idx + 2].domain[0] = domMid;
-				data[idx + 2].domain[1] = data[idx].domain[1];
+		// Companion matrix, which is upper Hessenberg ( 1-indexed )
+		Real a[9][9], wr[9], wi[9];
+		for (int k = 1; k <= degree; k++) {
+			a[1][k] = -monoCoefs[degree - k] / monoCoefs[degree];
+			for (int j = 2; j <= degree; j++)
+				a[j][k] = 0.0;
+			if (k != degree)
+				a[k + 1][k] = 1.0;
+		}
+		companionBalance(a, degree);
+		if (!companionHQR(a, degree, wr, wi)) {
+			// Fall back to Bezier subdivision
+			solveBPBezier(monoCoefs, domains, domainNum, roots, rootNum, ws);
+			return;
+		}
 
-				data[idx] = data[idx + 1];
-				data[idx + 1] = data[idx + 2];
-				idx++;
+		for (int i = 1; i <= degree; i++) {
+			// Double roots could be split into complex pair with small imaginary part
+			if (fabs(wi[i]) > COMPANION_IMAG_EPS)
 				continue;
+
+			// Polish eigenvalue with NR on monomial form
+			Real x = wr[i];
+			for (int k = 0; k < NR_MAX_ITER; k++) {
+				Real value = monoCoefs[degree], deriv = 0.0;
+				for (int j = degree - 1; j >= 0; j--) {
+					deriv = deriv * x + value;
+					value = value * x + monoCoefs[j];
+				}
+				if (fabs(value) < ROOT_EPS || deriv == 0.0)
+					break;
+				x -= value / deriv;
+			}
+
+			for (int j = 0; j < domainNum; j++) {
+				if (x >= domains[j].beg() - TOL && x <= domains[j].end() + TOL) {
+					pushRootBP(roots, rootNum, x);
+					break;
+				}
+			}
+		}
+	}
+	// Lockstep
+	// Elevate degree of [ M ] to 8 without changing the polynomial, and store it in [ l ]-th lane of [ coefs ]
+	inline static void elevateLaneBP(const CircleBinormal::BP& M, Real coefs[9][CircleBinormal::BatchWorkspace::lanes], Real dCoefs[8][CircleBinormal::BatchWorkspace::lanes], int l) {
+		Real c[9];
+		for (int i = 0; i <= M.degree; i++)
+			c[i] = M.coefs[i];
+		for (int d = M.degree; d < 8; d++) {
+			c[d + 1] = c[d];
+			for (int i = d; i >= 1; i--)
+				c[i] = (i / (Real)(d + 1)) * c[i - 1] + (1.0 - i / (Real)(d + 1)) * c[i];
+		}
+		for (int i = 0; i <= 8; i++)
+			coefs[i][l] = c[i];
+		for (int i = 0; i < 8; i++)
+			dCoefs[i][l] = c[i + 1] - c[i];
+	}
+	// Evaluate degree 8 Bezier polynomials of every lane at once
+	// Lanes are the inner dimension of every loop, so that each loop is vectorized over lanes
+	inline static void evaluateLanesBP(const Real coefs[9][CircleBinormal::BatchWorkspace::lanes], const Real dCoefs[8][CircleBinormal::BatchWorkspace::lanes], const Real t[], Real value[], Real deriv[]) {
+		static const int L = CircleBinormal::BatchWorkspace::lanes;
+		Real memA[9][L];
+		Real memB[9][L];
+		for (int l = 0; l < L; l++) {
+			memA[0][l] = 1.0;
+			memB[0][l] = 1.0;
+			value[l] = 0.0;
+			deriv[l] = 0.0;
+		}
+		for (int i = 1; i <= 8; i++) {
+			for (int l = 0; l < L; l++) {
+				memA[i][l] = memA[i - 1][l] * (1.0 - t[l]);
+				memB[i][l] = memB[i - 1][l] * t[l];
 			}
 		}
+		for (int i = 0; i <= 8; i++)
+			for (int l = 0; l < L; l++)
+				value[l] += coefs[i][l] * binomial[8][i] * memA[8 - i][l] * memB[i][l];
+		for (int i = 0; i < 8; i++)
+			for (int l = 0; l < L; l++)
+				deriv[l] += dCoefs[i][l] * binomial[7][i] * memA[7 - i][l] * memB[i][l];
+		for (int l = 0; l < L; l++)
+			deriv[l] *= 8;
+	}
+	void CircleBinormal::solvePolynomials(int num, const Real coefs[], const Domain domains[], int domainNum, Real roots[], int rootNum[], BatchWorkspace& ws) {
+		static const int L = BatchWorkspace::lanes;
+		int		poly[L];			// Index of polynomial that each lane is working on ( -1 if idle )
+		int		idx[L];				// Top of subdivision stack of each lane
+		int		ready[L];			// 1 if lane has a domain to run NR in this step
+		int		running[L];			// 1 while NR is running on the lane
+		int		found[L];			// 1 if NR converged to a root
+		Real	laneCoefs[9][L];	// Top domain of each lane, elevated to degree 8
+		Real	laneDcoefs[8][L];
+		Real	nrRoot[L];
+		Real	nrRootCopy[L];
+		Real	value[L];
+		Real	deriv[L];
+		int		next = 0;			// Next polynomial to be assigned to an idle lane
+
+		if (domainNum > Workspace::domainCapacity)
+			throw(std::runtime_error("Too many domains for circle binormal workspace"));
+		ws.validDomainNum = domainNum;	// Valid domains are same for every polynomial, and set by [ initBP ]
+
+		for (int l = 0; l < L; l++) {
+			poly[l] = -1;
+			idx[l] = -1;
+		}
+		while (true) {
+			// 1. Get every lane ready for NR : Pop purged domains, and refill finished lanes from queue
+			int readyNum = 0;
+			for (int l = 0; l < L; l++) {
+				ready[l] = 0;
+				while (true) {
+					if (idx[l] < 0) {
+						if (poly[l] >= 0) {
+							recoverRootsBP(&roots[poly[l] * maxRootNum], rootNum[poly[l]]);
+							poly[l] = -1;
+						}
+						if (next >= num)
+							break;
+						poly[l] = next++;
+						rootNum[poly[l]] = 0;
+						BP m = initBP(&coefs[poly[l] * 9], domains, domainNum, ws.validDomains);
+						factorEndsBP(m, &roots[poly[l] * maxRootNum], rootNum[poly[l]]);
+						if (m.degree == 0)
+							continue;
+						ws.data[l][0] = m;
+						idx[l] = 0;
+					}
+					if (!popStackBP(ws.data[l], idx[l], ws.validDomains, ws.validDomainNum, &roots[poly[l] * maxRootNum], rootNum[poly[l]]))
+						continue;
 
-		// Change roots to original domain
-		for (int i = 0; i < rootNum; i++)
-			roots[i] = roots[i] * 2.0 * (1 + TOL) - (1 + TOL);
+					const BP& top = ws.data[l][idx[l]];
+					nrRoot[l] = nrRootCopy[l] = estimateBP(top);
+					elevateLaneBP(top, laneCoefs, laneDcoefs, l);
+					ready[l] = 1;
+					readyNum++;
+					break;
+				}
+				if (!ready[l]) {
+					// Idle lane still runs through the kernel, so give it harmless values
+					nrRoot[l] = 0.5;
+					for (int i = 0; i <= 8; i++)
+						laneCoefs[i][l] = 1.0;
+					for (int i = 0; i < 8; i++)
+						laneDcoefs[i][l] = 0.0;
+				}
+				running[l] = ready[l];
+				found[l] = 0;
+			}
+			if (readyNum == 0)
+				break;	// Every lane is idle and queue is empty
+
+			// 2. NR in lockstep : Lanes that are done are masked off, and iteration stops when every lane is done
+			int runningNum = readyNum;
+			for (int i = 0; i < NR_MAX_ITER && runningNum > 0; i++) {
+				BINORMAL_STATS_ADD(solveNRIterNum, runningNum);
+				evaluateLanesBP(laneCoefs, laneDcoefs, nrRoot, value, deriv);
+				runningNum = 0;
+				for (int l = 0; l < L; l++) {
+					int converged = fabs(value[l]) < ROOT_EPS;		// Found root
+					int divergent = deriv[l] == 0.0;				// Divergent step
+					int step = running[l] & !converged & !divergent;
+					Real t = nrRoot[l] - value[l] / (divergent ? 1.0 : deriv[l]);
+
+					found[l] |= running[l] & converged;
+					nrRoot[l] = step ? t : nrRoot[l];
+					running[l] = step & (t >= 0) & (t <= 1);		// Out of domain
+					runningNum += running[l];
+				}
+			}
+
+			// 3. Subdivide with the result of NR
+			for (int l = 0; l < L; l++) {
+				if (!ready[l])
+					continue;
+				if (!found[l])
+					BINORMAL_STATS(solveNRFailNum);
+				subdivideStackBP(ws.data[l], idx[l], found[l] != 0, nrRoot[l], nrRootCopy[l], &roots[poly[l] * maxRootNum], rootNum[poly[l]]);
+			}
+		}
 	}
 
 	// NR
@@ -495,6 +1103,7 @@ namespace MN {
 		bool largerEps = false;
 
 		for (k = 0; k < NR_MAX_ITER; k++) {
+			BINORMAL_STATS(binormalNRIterNum);
 			// User function supplies function values at [x] in [dvec] and Jacobian matrix in [djac].
 			dist = binormalNRFunc(param, fvec, dvec, djac, a, b, btoa);
 
@@ -521,6 +1130,7 @@ namespace MN {
 				param[i] += p[i];
 			}
 		}
+		BINORMAL_STATS(binormalNRFailNum);
 		return false;
 	}
 
@@ -541,8 +1151,39 @@ namespace MN {
 		if (det > 0)
 			roots[num++] = (-c[1] - det) / c[0];
 	}
+	// Build binormal from its parameters
+	inline static void makeBinormal(const CircularArc& a, const CircularArc& b, const Transform& btoa, Real paramA, Real paramB, CircleBinormal::Binormal& nbin) {
+		Real x = piDomain::regularize(paramA);
+		Real y = piDomain::regularize(paramB);
+		nbin.paramA = x;
+		nbin.paramB = y;
+		nbin.pointA = a.evaluate(x);
+		nbin.pointB = b.evaluate(y);
+		nbin.distance = btoa.apply(nbin.pointB).dist(nbin.pointA);
+
+		// Type check
+		if (nbin.pointA.dist(btoa.T) < PROXIMITY_EPS) {
+			Vec3 atan = a.differentiate(x, 1);
+			atan.normalize();
+			Real det = atan.dot(Vec3{ btoa.R[0][2], btoa.R[1][2], btoa.R[2][2] });
+			if (fabs(det) > 1 - 1e-10) nbin.type = 3;
+			else nbin.type = 0;
+		}
+		else nbin.type = 0;
+	}
+	// Swap roles of two arcs in [ bin ], which was found with arc B as arc A
+	inline static void swapBinormal(CircleBinormal::Binormal& bin) {
+		std::swap(bin.paramA, bin.paramB);
+		std::swap(bin.pointA, bin.pointB);
+		if (bin.type == 2)
+			bin.type = 3;
+		else if (bin.type == 3)
+			bin.type = 2;
+	}
 	// Add new binormal to binormal vector without duplication
-	inline static void safeAddBinormal(const CircularArc& a, const CircularArc& b, const Transform& btoa, Real paramA, Real paramB, std::vector<CircleBinormal::Binormal>& bins) {
+	// @Bins : std::vector of binormals, or [ ExceptionBinormals ]
+	template<typename Bins>
+	inline static void safeAddBinormal(const CircularArc& a, const CircularArc& b, const Transform& btoa, Real paramA, Real paramB, Bins& bins) {
 		Real x, y, diffX, diffY;
 		bool duplicate, sameX, sameY;
 		
@@ -555,27 +1196,14 @@ namespace MN {
 			sameX = (diffX < DOMAIN_EPS) || (diffX > PI20 - DOMAIN_EPS);
 			sameY = (diffY < DOMAIN_EPS) || (diffY > PI20 - DOMAIN_EPS);
 			if (sameX && sameY) {
+				BINORMAL_STATS(duplicateNum);
 				duplicate = true;
 				break;
 			}
 		}
 		if (!duplicate) {
 			CircleBinormal::Binormal nbin;
-			nbin.paramA = x;
-			nbin.paramB = y;
-			nbin.pointA = a.evaluate(x);
-			nbin.pointB = b.evaluate(y);
-			nbin.distance = btoa.apply(nbin.pointB).dist(nbin.pointA);
-
-			// Type check
-			if (nbin.pointA.dist(btoa.T) < PROXIMITY_EPS) {
-				Vec3 atan = a.differentiate(x, 1);
-				atan.normalize();
-				Real det = atan.dot(Vec3{ btoa.R[0][2], btoa.R[1][2], btoa.R[2][2] });
-				if (fabs(det) > 1 - 1e-10) nbin.type = 3;
-				else nbin.type = 0;
-			}
-			else nbin.type = 0;
+			makeBinormal(a, b, btoa, x, y, nbin);
 			bins.push_back(nbin);
 		}
 	}
@@ -681,6 +1309,7 @@ namespace MN {
 		if (axisD < 1 - PROXIMITY_EPS) 
 			return false;
 
+		BINORMAL_STATS(exceptionANum);
 		return true;
 	}
 	inline static void arcPlaneIntersection(const CircularArc& arc, Real u, const Vec3& normal, Real p, Vec3 pt[4], Real param[4], int& num) {
@@ -738,7 +1367,7 @@ namespace MN {
 			for (int i = 0; i < cosnum; i++) {
 				if (fabs(cosu[i]) > 1) {
 					if (fabs(cosu[i]) < 1 + 1e-10) {
-						if (cosu > 0) cosu[i] = 1;
+						if (cosu[i] > 0) cosu[i] = 1;
 						else cosu[i] = -1;
 					}
 					else
@@ -752,7 +1381,8 @@ namespace MN {
 		}
 	}
 	// For given value [ bu ], check if there are points on circle [ a ] that form binormal line with [ B(bu) ]
-	inline static void subroutineExceptionB2(const CircularArc& a, const CircularArc& b, const Transform& btoa, Real bu, std::vector<CircleBinormal::Binormal>& bins) {
+	template<typename Bins>
+	inline static void subroutineExceptionB2(const CircularArc& a, const CircularArc& b, const Transform& btoa, Real bu, Bins& bins) {
 		Vec3 bpt, bptA, btanA;
 		bpt = b.evaluate(bu);
 		bptA = btoa.apply(bpt);
@@ -761,17 +1391,21 @@ namespace MN {
 		Real d = sqrt(bptA[0] * bptA[0] + bptA[1] * bptA[1]);
 		if (d > 1e-10) return;
 
+		BINORMAL_STATS(exceptionBNum);
 		btanA = btoa.applyR(b.differentiate(bu, 1));
 		btanA.normalize();
 		if (fabs(btanA[2]) > 1 - 1e-10) {
 			// When [ btanA ] is parallel to circle A's axis
 			if (fabs(bptA[2]) < 1e-10) {
 				// If [ bptA ] equals to the center of circle B
+				// Every point on [ a ] is equally distant, so the beginning of its domain is given
 				CircleBinormal::Binormal bin;
 				bin.type = 2;
+				bin.paramA = a.domain.beg();
+				bin.pointA = a.evaluate(bin.paramA);
 				bin.pointB = bpt;
 				bin.paramB = bu;
-				bin.distance = (bptA - (a.evaluate(0))).len();
+				bin.distance = (bptA - bin.pointA).len();
 				bins.push_back(bin);
 				return;
 			}
@@ -796,7 +1430,8 @@ namespace MN {
 	}
 	// For given value [ bTriU ], compute parameter [ u ] for circle [ b ] that goes through axis of circle [ a ]
 	// @isCos : Trus if [ bTriU ] is cosine value of parameter [ u ]. False if it is sine value
-	inline static void subroutineExceptionB(const CircularArc& a, const CircularArc& b, const Transform& btoa, Real bTriU, std::vector<CircleBinormal::Binormal>& bins, bool isCos) {
+	template<typename Bins>
+	inline static void subroutineExceptionB(const CircularArc& a, const CircularArc& b, const Transform& btoa, Real bTriU, Bins& bins, bool isCos) {
 		Real abs = fabs(bTriU);
 		if (abs > 1) {
 			if (abs < 1 + 1e-10) {
@@ -821,7 +1456,8 @@ namespace MN {
 				subroutineExceptionB2(a, b, btoa, PI - u0, bins);
 		}
 	}
-	void CircleBinormal::exceptionB(const CircularArc& a, const CircularArc& b, const Transform& btoa, std::vector<Binormal>& bins) {
+	template<typename Bins>
+	void CircleBinormal::exceptionB(const CircularArc& a, const CircularArc& b, const Transform& btoa, Bins& bins) {
 		Vec3 uVec, vVec;
 		uVec = { btoa.R[0][0], btoa.R[1][0], btoa.R[2][0] };
 		vVec = { btoa.R[0][1], btoa.R[1][1], btoa.R[2][1] };
@@ -866,25 +1502,21 @@ namespace MN {
 		}
 	}
 
-	// Solve
-	void CircleBinormal::subroutine(const CircularArc& a, const CircularArc& b, const Transform& btoa, const std::vector<Domain>& bCosDomains, std::vector<Binormal>& bins, bool refine, Real precision) {
-		// Assume [ a ] is located on XY plane.
-		Vec3 C, U, V;	// Center, orthonormal direction of [ b ] in [ a ]'s local coordinates.
-		C = btoa.T;
-		U = { btoa.R[0][0], btoa.R[1][0], btoa.R[2][0] };
-		V = { btoa.R[0][1], btoa.R[1][1], btoa.R[2][1] };
-
+	// Build 8-th degree polynomial in cosine of circle B's parameter, whose roots give candidate binormals
+	// Every branch is written as a select, so that it can be vectorized when called in a loop over SoA data
+	// @r0, r1 : Radius of circle B, A
+	// @C, U, V : Center, orthonormal direction of circle B in A's local coordinates
+	// @coef : Normalized coefficients of the polynomial ( coef[i] for cos^i )
+	inline static void binormalPolynomial(Real r0, Real r1, const Real C[3], const Real U[3], const Real V[3], Real coef[9]) {
 		Real coefA[6];
-		coefA[0] = C.dot(U);
-		coefA[1] = C.dot(V);
+		coefA[0] = C[0] * U[0] + C[1] * U[1] + C[2] * U[2];
+		coefA[1] = C[0] * V[0] + C[1] * V[1] + C[2] * V[2];
 		coefA[2] = C[2];
 		coefA[3] = U[2];
 		coefA[4] = V[2];
-		coefA[5] = C.dot(C);
+		coefA[5] = C[0] * C[0] + C[1] * C[1] + C[2] * C[2];
 
-		Real r0, r1, r0_2, r0_3, r0_4, r1_2_m;
-		r0 = b.radius;
-		r1 = a.radius;
+		Real r0_2, r0_3, r0_4, r1_2_m;
 		r0_2 = SQ(r0);
 		r0_3 = r0_2 * r0;
 		r0_4 = r0_3 * r0;
@@ -951,7 +1583,6 @@ namespace MN {
 		z[4] = 2.0 * x[1] * x[3];
 		z[5] = 2.0 * x[2] * x[3];
 
-		Real coef[9];
 		coef[0] = SQ(x[4]) - SQ(x[0]);
 		coef[1] = 2.0 * x[4] * x[5] - z[0];
 		coef[2] = 2.0 * x[4] * x[6] + SQ(x[5]) - SQ(x[1]) - z[1] + SQ(x[0]);
@@ -963,30 +1594,137 @@ namespace MN {
 		coef[8] = SQ(x[8]) + SQ(x[3]);
 
 		// @BUGFIX : Make coefficients stable
-		Real coefMin = maxDouble, coefMax = 0, coefAvg;
+		Real coefMin = maxDouble, coefMax = 0, coefAvg, coefAbs;
 		for (int i = 0; i < 9; i++) {
-			if (fabs(coef[i]) > coefMax)
-				coefMax = fabs(coef[i]);
-			if (fabs(coef[i]) < coefMin)
-				coefMin = fabs(coef[i]);
+			coefAbs = fabs(coef[i]);
+			coefMax = (coefAbs > coefMax) ? coefAbs : coefMax;
+			coefMin = (coefAbs < coefMin) ? coefAbs : coefMin;
 		}
 		coefAvg = (coefMin + coefMax) * 0.5;
-		if (coefAvg > 0)
-			for (int i = 0; i < 9; i++)
-				coef[i] /= coefAvg;
+		coefAvg = (coefAvg > 0) ? (1.0 / coefAvg) : 1.0;
+		for (int i = 0; i < 9; i++)
+			coef[i] *= coefAvg;
+	}
+
+	// Slightly extend domain of [ arc ] for stable projection
+	inline static void extendArcDomain(CircularArc& arc) {
+		if (arc.domain.width() < PI20 - PROJECTION_EPS * 2) arc.domain.set(arc.domain.beg() - PROJECTION_EPS, arc.domain.end() + PROJECTION_EPS);
+		else arc.domain.set(0, PI20);
+	}
+
+	// Special configurations
+	// Add [ cosT ] to [ roots ] if it is in one of [ domains ]
+	inline static void addClosedFormRoot(Real cosT, const Domain domains[], int domainNum, Real roots[], int& rootNum) {
+		for (int i = 0; i < domainNum; i++) {
+			if (cosT >= domains[i].beg() - TOL && cosT <= domains[i].end() + TOL) {
+				roots[rootNum++] = cosT;
+				return;
+			}
+		}
+	}
+	// Find cosine of [ t ] that satisfies [ p * cos(t) + q * sin(t) = k ]
+	inline static void solveTrigonometricEquation(Real p, Real q, Real k, Real cosT[2], int& num) {
+		num = 0;
+		Real rho = sqrt(p * p + q * q);
+		if (rho < PROXIMITY_EPS)
+			return;
+		Real c = k / rho;
+		if (fabs(c) > 1) {
+			if (fabs(c) > 1 + TOL) return;
+			c = (c > 0) ? 1 : -1;
+		}
+		Real phi = atan2(q, p), d = acos(c);
+		cosT[num++] = cos(phi + d);
+		if (d > 0)
+			cosT[num++] = cos(phi - d);
+	}
+	// In following configurations, 8-th degree polynomial collapses and its roots ( cosine of [ b ]'s parameter ) can be found in closed form
+	// 1. Parallel axes ( including coplanar circles ) : 
+	//		Binormals are on the line through both centers ( seen from the axis ), or at intersections of circles projected on [ a ]'s plane
+	// 2. Center of [ b ] on [ a ]'s axis :
+	//		For [ v = cos(t) * U[2] + sin(t) * V[2] ], either [ dv / dt = 0 ] or [ v = +-h / sqrt(r^2 + h^2) ] ( r = radius of [ a ], h = height of [ b ]'s center )
+	// @ret : False if none of above holds, and general polynomial has to be solved
+	inline static bool closedFormRoots(const CircularArc& a, const CircularArc& b, const Real C[3], const Real U[3], const Real V[3], const Domain domains[], int domainNum, Real roots[], int& rootNum) {
+		Real cosT[2];
+		int num;
+		rootNum = 0;
+
+		Real cxy = sqrt(C[0] * C[0] + C[1] * C[1]);
+		bool parallel = fabs(U[2]) < PROXIMITY_EPS && fabs(V[2]) < PROXIMITY_EPS;
+		if (parallel) {
+			if (cxy < PROXIMITY_EPS)
+				return false;	// Coaxial, which is handled by [ exceptionA ]
+
+			// Points on the line through both centers
+			Real d[2] = { C[0] / cxy, C[1] / cxy };
+			Real dU = d[0] * U[0] + d[1] * U[1];
+			addClosedFormRoot(dU, domains, domainNum, roots, rootNum);
+			addClosedFormRoot(-dU, domains, domainNum, roots, rootNum);
+
+			// Intersections of projected circles : | C + rb * ( cos(t) * U + sin(t) * V ) |^2 = ra^2 on XY plane
+			Real CU = C[0] * U[0] + C[1] * U[1];
+			Real CV = C[0] * V[0] + C[1] * V[1];
+			solveTrigonometricEquation(CU, CV, (a.radius * a.radius - cxy * cxy - b.radius * b.radius) / (2.0 * b.radius), cosT, num);
+			for (int i = 0; i < num; i++)
+				addClosedFormRoot(cosT[i], domains, domainNum, roots, rootNum);
+			return true;
+		}
+		if (cxy < PROXIMITY_EPS) {
+			Real rho = sqrt(U[2] * U[2] + V[2] * V[2]);
+
+			// [ dv / dt = 0 ]
+			addClosedFormRoot(U[2] / rho, domains, domainNum, roots, rootNum);
+			addClosedFormRoot(-U[2] / rho, domains, domainNum, roots, rootNum);
+
+			// [ v = +-h / sqrt(r^2 + h^2) ]
+			Real v = C[2] / sqrt(a.radius * a.radius + C[2] * C[2]);
+			solveTrigonometricEquation(U[2], V[2], v, cosT, num);
+			for (int i = 0; i < num; i++)
+				addClosedFormRoot(cosT[i], domains, domainNum, roots, rootNum);
+			if (v != 0) {
+				solveTrigonometricEquation(U[2], V[2], -v, cosT, num);
+				for (int i = 0; i < num; i++)
+					addClosedFormRoot(cosT[i], domains, domainNum, roots, rootNum);
+			}
+			return true;
+		}
+		return false;
+	}
+
+	// Solve
+	void CircleBinormal::subroutine(const CircularArc& a, const CircularArc& b, const Transform& btoa, const Domain bCosDomains[], int bCosDomainNum, Workspace& ws, std::vector<Binormal>& bins, bool refine, Real precision) {
+		// Assume [ a ] is located on XY plane.
+		Real C[3], U[3], V[3];	// Center, orthonormal direction of [ b ] in [ a ]'s local coordinates.
+		for (int i = 0; i < 3; i++) {
+			C[i] = btoa.T[i];
+			U[i] = btoa.R[i][0];
+			V[i] = btoa.R[i][1];
+		}
 
-		Real roots[16];
+		Real roots[maxRootNum];
 		int rootNum;
+		if (closedFormRoots(a, b, C, U, V, bCosDomains, bCosDomainNum, roots, rootNum)) {
+			processRoots(a, b, btoa, roots, rootNum, bins, refine, precision);
+			return;
+		}
 
-		// @ Since BezierPolynomial automatically culls out duplicate roots, we do not have to test it
-		solveBP(coef, bCosDomains, roots, rootNum);
+		Real coef[9];
+		binormalPolynomial(b.radius, a.radius, C, U, V, coef);
+		subroutine(a, b, btoa, coef, bCosDomains, bCosDomainNum, ws, bins, refine, precision);
+	}
+	void CircleBinormal::subroutine(const CircularArc& a, const CircularArc& b, const Transform& btoa, const Real coef[9], const Domain bCosDomains[], int bCosDomainNum, Workspace& ws, std::vector<Binormal>& bins, bool refine, Real precision) {
+		Real roots[maxRootNum];
+		int rootNum;
 
+		// @ Since BezierPolynomial automatically culls out duplicate roots, we do not have to test it
+		solveBP(coef, bCosDomains, bCosDomainNum, roots, rootNum, ws);
+		processRoots(a, b, btoa, roots, rootNum, bins, refine, precision);
+	}
+	void CircleBinormal::processRoots(const CircularArc& a, const CircularArc& b, const Transform& btoa, Real roots[], int rootNum, std::vector<Binormal>& bins, bool refine, Real precision) {
 		// Slightly extend domain for stability
 		CircularArc aCopy = a, bCopy = b;
-		if (aCopy.domain.width() < PI20 - PROJECTION_EPS * 2) aCopy.domain.set(aCopy.domain.beg() - PROJECTION_EPS, aCopy.domain.end() + PROJECTION_EPS);
-		else aCopy.domain.set(0, PI20);
-		if (bCopy.domain.width() < PI20 - PROJECTION_EPS * 2) bCopy.domain.set(bCopy.domain.beg() - PROJECTION_EPS, bCopy.domain.end() + PROJECTION_EPS);
-		else bCopy.domain.set(0, PI20);
+		extendArcDomain(aCopy);
+		extendArcDomain(bCopy);
 
 		Binormal tmpBins[4];
 		for (int i = 0; i < rootNum; i++) {
@@ -1010,28 +1748,48 @@ namespace MN {
 		}
 	}
 	void CircleBinormal::solve(const Circle& a, const Circle& b, const Transform& tA, const Transform& tB, std::vector<Binormal>& bins, bool refine, Real precision) {
-		Transform btoa = Transform::connect(tB, tA);
-		solve(a, b, btoa, bins, refine, precision);
+		solve(a, b, tA, tB, getWorkspace(), bins, refine, precision);
 	}
 	void CircleBinormal::solve(const CircularArc& a, const CircularArc& b, const Transform& tA, const Transform& tB, std::vector<Binormal>& bins, bool refine, Real precision) {
-		Transform btoa = Transform::connect(tB, tA);
-		solve(a, b, btoa, bins, refine, precision);
+		solve(a, b, tA, tB, getWorkspace(), bins, refine, precision);
 	}
 	void CircleBinormal::solve(const Circle& a, const Circle& b, const Transform& btoa, std::vector<Binormal>& bins, bool refine, Real precision) {
-		CircularArc arcA, arcB;
-		arcA.radius = a.radius;
-		arcB.radius = b.radius;
-		arcA.domain = piDomain::create(0, PI20);
-		arcB.domain = piDomain::create(0, PI20);
-
-		solve(arcA, arcB, btoa, bins, refine, precision);
+		solve(a, b, btoa, getWorkspace(), bins, refine, precision);
 	}
 	void CircleBinormal::solve(const CircularArc& a, const CircularArc& b, const Transform& btoa, std::vector<Binormal>& bins, bool refine, Real precision) {
-		// For numerical stability, scale circles to make average radius to be 1.0
-		Real avgRadius = (a.radius + b.radius) * 0.5;
-
-		Transform nbtoa = btoa;
-		nbtoa.T /= avgRadius;
+		solve(a, b, btoa, getWorkspace(), bins, refine, precision);
+	}
+	void CircleBinormal::solve(const Circle& a, const Circle& b, const Transform& btoa, const std::vector<piDomain>& bDomain, std::vector<Binormal>& bins, bool refine, Real precision) {
+		solve(a, b, btoa, bDomain, getWorkspace(), bins, refine, precision);
+	}
+	void CircleBinormal::solve(const CircularArc& a, const CircularArc& b, const Transform& btoa, const std::vector<piDomain>& bDomain, std::vector<Binormal>& bins, bool refine, Real precision) {
+		solve(a, b, btoa, bDomain, getWorkspace(), bins, refine, precision);
+	}
+
+	// Reentrant solve
+	void CircleBinormal::solve(const Circle& a, const Circle& b, const Transform& tA, const Transform& tB, Workspace& ws, std::vector<Binormal>& bins, bool refine, Real precision) {
+		Transform btoa = Transform::connect(tB, tA);
+		solve(a, b, btoa, ws, bins, refine, precision);
+	}
+	void CircleBinormal::solve(const CircularArc& a, const CircularArc& b, const Transform& tA, const Transform& tB, Workspace& ws, std::vector<Binormal>& bins, bool refine, Real precision) {
+		Transform btoa = Transform::connect(tB, tA);
+		solve(a, b, btoa, ws, bins, refine, precision);
+	}
+	void CircleBinormal::solve(const Circle& a, const Circle& b, const Transform& btoa, Workspace& ws, std::vector<Binormal>& bins, bool refine, Real precision) {
+		CircularArc arcA, arcB;
+		arcA.radius = a.radius;
+		arcB.radius = b.radius;
+		arcA.domain = piDomain::create(0, PI20);
+		arcB.domain = piDomain::create(0, PI20);
+
+		solve(arcA, arcB, btoa, ws, bins, refine, precision);
+	}
+	void CircleBinormal::solve(const CircularArc& a, const CircularArc& b, const Transform& btoa, Workspace& ws, std::vector<Binormal>& bins, bool refine, Real precision) {
+		// For numerical stability, scale circles to make average radius to be 1.0
+		Real avgRadius = (a.radius + b.radius) * 0.5;
+
+		Transform nbtoa = btoa;
+		nbtoa.T /= avgRadius;
 
 		CircularArc arcA = a, arcB = b;
 		arcA.radius = a.radius / avgRadius;
@@ -1070,13 +1828,13 @@ namespace MN {
 
 		// Solve 8-th degree polynomial of the circle with smaller domain
 		if (aCosDom.width() >= bCosDom.width())
-			subroutine(arcA, arcB, nbtoa, { bCosDom }, bins, refine, precision);
+			subroutine(arcA, arcB, nbtoa, &bCosDom, 1, ws, bins, refine, precision);
 		else {
-			subroutine(arcB, arcA, nbtoa.inverse(), { aCosDom }, bins, refine, precision);
-			for (auto& bin : bins) {
-				std::swap(bin.paramA, bin.paramB);
-				std::swap(bin.pointA, bin.pointB);
-			}
+			// Binormals of [ exceptionB ] are already in the right order
+			int exceptionNum = (int)bins.size();
+			subroutine(arcB, arcA, nbtoa.inverse(), &aCosDom, 1, ws, bins, refine, precision);
+			for (int i = exceptionNum; i < (int)bins.size(); i++)
+				swapBinormal(bins[i]);
 		}
 		
 		// Recover real radius and distance
@@ -1087,7 +1845,7 @@ namespace MN {
 		}
 	}
 
-	void CircleBinormal::solve(const Circle& a, const Circle& b, const Transform& btoa, const std::vector<piDomain>& bDomain, std::vector<Binormal>& bins, bool refine, Real precision) {
+	void CircleBinormal::solve(const Circle& a, const Circle& b, const Transform& btoa, const std::vector<piDomain>& bDomain, Workspace& ws, std::vector<Binormal>& bins, bool refine, Real precision) {
 		// For numerical stability, scale circles to make average radius to be 1.0
 		Real avgRadius = (a.radius + b.radius) * 0.5;
 
@@ -1113,8 +1871,10 @@ namespace MN {
 		// Exception 2
 		exceptionB(arcA, arcB, nbtoa, bins);	// @TODO : It is not problem only for torus binormal with gaussmap...
 
-		std::vector<Domain> bCosDomains;
-		bCosDomains.reserve(bDomain.size());
+		if ((int)bDomain.size() > Workspace::domainCapacity)
+			throw(std::runtime_error("Too many valid domains for circle binormal workspace"));
+		Domain bCosDomains[Workspace::domainCapacity];
+		int bCosDomainNum = 0;
 
 		Domain cosDomain;
 		for (auto& domain : bDomain) {
@@ -1125,9 +1885,9 @@ namespace MN {
 			if (domain.has(0) || domain.has(PI20)) end = 1;
 			else end = (bBegCos > bEndCos) ? bBegCos : bEndCos;
 			cosDomain.set(beg, end);
-			bCosDomains.push_back(cosDomain);
+			bCosDomains[bCosDomainNum++] = cosDomain;
 		}
-		subroutine(arcA, arcB, nbtoa, bCosDomains, bins, refine, precision);
+		subroutine(arcA, arcB, nbtoa, bCosDomains, bCosDomainNum, ws, bins, refine, precision);
 
 		for (auto& bin : bins) {
 			bin.pointA *= avgRadius;
@@ -1135,7 +1895,7 @@ namespace MN {
 			bin.distance *= avgRadius;
 		}
 	}
-	void CircleBinormal::solve(const CircularArc& a, const CircularArc& b, const Transform& btoa, const std::vector<piDomain>& bDomain, std::vector<Binormal>& bins, bool refine, Real precision) {
+	void CircleBinormal::solve(const CircularArc& a, const CircularArc& b, const Transform& btoa, const std::vector<piDomain>& bDomain, Workspace& ws, std::vector<Binormal>& bins, bool refine, Real precision) {
 		// For numerical stability, scale circles to make average radius to be 1.0
 		Real avgRadius = (a.radius + b.radius) * 0.5;
 
@@ -1159,8 +1919,10 @@ namespace MN {
 		// Exception 2
 		exceptionB(arcA, arcB, nbtoa, bins);	// @TODO : It is not problem only for torus binormal with gaussmap...
 
-		std::vector<Domain> bCosDomains;
-		bCosDomains.reserve(bDomain.size());
+		if ((int)bDomain.size() > Workspace::domainCapacity)
+			throw(std::runtime_error("Too many valid domains for circle binormal workspace"));
+		Domain bCosDomains[Workspace::domainCapacity];
+		int bCosDomainNum = 0;
 
 		Domain cosDomain;
 		for (auto& domain : bDomain) {
@@ -1171,60 +1933,901 @@ namespace MN {
 			if (domain.has(0) || domain.has(PI20)) end = 1;
 			else end = (bBegCos > bEndCos) ? bBegCos : bEndCos;
 			cosDomain.set(beg, end);
-			bCosDomains.push_back(cosDomain);
+			bCosDomains[bCosDomainNum++] = cosDomain;
 		}
-		subroutine(arcA, arcB, nbtoa, bCosDomains, bins, refine, precision);
+		subroutine(arcA, arcB, nbtoa, bCosDomains, bCosDomainNum, ws, bins, refine, precision);
 
-		std::vector<Binormal> nbins;
-		nbins.reserve(bins.size());
+		// Filter out binormals that are out of domain in place, to avoid allocation
+		size_t nbinNum = 0;
 		for (auto& bin : bins) {
 			if (a.domain.has(bin.paramA) && b.domain.has(bin.paramB)) {
 				bin.pointA *= avgRadius;
 				bin.pointB *= avgRadius;
 				bin.distance *= avgRadius;
-				nbins.push_back(bin);
+				bins[nbinNum++] = bin;
 			}
 		}
-		bins = nbins;
+		bins.resize(nbinNum);
 	}
-	// Brute Solve
-	static void bruteSolveAtGivenParam(const CircularArc& a, const CircularArc& b, Real aparam, Real bparam, const Transform& btoa, std::vector<CircleBinormal::Binormal>& bins, Real precision);
-	static void bruteSolveAtGivenBParam(const CircularArc& a, const CircularArc& b, Real bparam, const Transform& btoa, std::vector<CircleBinormal::Binormal>& bins, Real precision);
-	void CircleBinormal::bruteSolve(const CircularArc& a, const CircularArc& b, const Transform& tA, const Transform& tB, std::vector<Binormal>& bins, Real precision, int sampleNum) {
+	// Min-distance solve
+	// Distance between circle [ a ] and point [ pt ] in [ a ]'s local coordinates
+	inline static Real pointCircleDistance(const Circle& a, const Vec3& pt) {
+		Real rho = sqrt(pt[0] * pt[0] + pt[1] * pt[1]) - a.radius;
+		return sqrt(rho * rho + pt[2] * pt[2]);
+	}
+	// Lower bound of distance between circle [ a ] and points on circle [ b ] whose parameter has cosine in [ cosBeg, cosEnd ]
+	// Those points form two arcs that are symmetric about X axis of [ b ]. Since distance to a circle is 1-Lipschitz,
+	// distance from the middle point of each arc minus its half chord is a lower bound.
+	inline static Real binormalLowerBound(const CircularArc& a, const CircularArc& b, const Transform& btoa, Real cosBeg, Real cosEnd) {
+		Real uBeg = acos(cosEnd), uEnd = acos(cosBeg);
+		Real uMid = (uBeg + uEnd) * 0.5;
+		Real halfChord = 2.0 * b.radius * sin((uEnd - uBeg) * 0.25);
+
+		Real bound = maxDouble;
+		for (int i = 0; i < 2; i++) {
+			Real d = pointCircleDistance(a, btoa.apply(b.evaluate(i == 0 ? uMid : -uMid)));
+			if (d < bound)
+				bound = d;
+		}
+		return bound - halfChord;
+	}
+	// Lower bound of [ binormalLowerBound ] for domain of Bezier polynomial [ M ]
+	inline static Real binormalLowerBound(const CircularArc& a, const CircularArc& b, const Transform& btoa, const CircleBinormal::BP& M) {
+		Real cosBeg = recoverRootBP(M.domain[0]);
+		Real cosEnd = recoverRootBP(M.domain[1]);
+		if (cosBeg < -1) cosBeg = -1;
+		if (cosEnd > 1) cosEnd = 1;
+		return binormalLowerBound(a, b, btoa, cosBeg, cosEnd);
+	}
+	// Refine potential binormals for given [ cosB ] parameter, and keep the shortest one in [ bin ]
+	// @aCopy, bCopy : [ a ], [ b ] with slightly extended domains
+	inline static void updateMinBinormal(const CircularArc& a, const CircularArc& b, const CircularArc& aCopy, const CircularArc& bCopy, const Transform& btoa, Real cosB, CircleBinormal::Binormal& bin, Real precision) {
+		if (fabs(cosB) > 1 + TOL) return;
+		else if (cosB > 1)	cosB = 1;
+		else if (cosB < -1) cosB = -1;
+
+		CircleBinormal::Binormal tmpBins[4], nbin;
+		int tnum;
+		findPotBinormal(aCopy, bCopy, btoa, cosB, tmpBins, tnum);
+		for (int i = 0; i < tnum; i++) {
+			// Binormal through [ B(paramB) ] cannot be shorter than distance from that point to circle [ a ]
+			if (pointCircleDistance(a, btoa.apply(b.evaluate(tmpBins[i].paramB))) >= bin.distance + PROJECTION_EPS)
+				continue;
+			Real param[3] = { 0, tmpBins[i].paramA, tmpBins[i].paramB };
+			bool success = binormalNR(a, b, btoa, param, precision);
+			if (!success || !a.domain.has(param[1]) || !b.domain.has(param[2]))
+				continue;
+			makeBinormal(a, b, btoa, param[1], param[2], nbin);
+			if (nbin.distance < bin.distance)
+				bin = nbin;
+		}
+	}
+	void CircleBinormal::subroutineMin(const CircularArc& a, const CircularArc& b, const Transform& btoa, const Domain bCosDomains[], int bCosDomainNum, Workspace& ws, Binormal& bin, Real precision) {
+		// Assume [ a ] is located on XY plane.
+		Real C[3], U[3], V[3];	// Center, orthonormal direction of [ b ] in [ a ]'s local coordinates.
+		for (int i = 0; i < 3; i++) {
+			C[i] = btoa.T[i];
+			U[i] = btoa.R[i][0];
+			V[i] = btoa.R[i][1];
+		}
+		CircularArc aCopy = a, bCopy = b;
+		extendArcDomain(aCopy);
+		extendArcDomain(bCopy);
+
+		Real roots[maxRootNum];
+		int rootNum;
+		if (closedFormRoots(a, b, C, U, V, bCosDomains, bCosDomainNum, roots, rootNum)) {
+			for (int i = 0; i < rootNum; i++)
+				updateMinBinormal(a, b, aCopy, bCopy, btoa, roots[i], bin, precision);
+			return;
+		}
+
+		Real coef[9];
+		binormalPolynomial(b.radius, a.radius, C, U, V, coef);
+
+		BP* data = ws.data;
+		BP m = initBP(coef, bCosDomains, bCosDomainNum, ws.validDomains);
+		ws.validDomainNum = bCosDomainNum;
+
+		rootNum = 0;
+		factorEndsBP(m, roots, rootNum);
+
+		// Depth first search as [ solveBP ], but every root is refined as soon as it is found to tighten [ bin.distance ],
+		// and domains that cannot have shorter binormal are discarded
+		int idx = (m.degree == 0) ? -1 : 0;
+		data[0] = m;
+		while (true) {
+			bool searching = popStackBP(data, idx, ws.validDomains, ws.validDomainNum, roots, rootNum);
+			for (int i = 0; i < rootNum; i++)
+				updateMinBinormal(a, b, aCopy, bCopy, btoa, recoverRootBP(roots[i]), bin, precision);
+			rootNum = 0;
+			if (!searching)
+				break;
+
+			if (binormalLowerBound(a, b, btoa, data[idx]) >= bin.distance) {
+				idx--;
+				continue;
+			}
+			Real nrRoot = estimateBP(data[idx]);
+			Real nrRootCopy = nrRoot;
+
+			setDcoefsBP(data[idx]);	// Have to get ready derivative coefficients before NR
+			bool found = solveNR(data[idx], nrRoot);
+			subdivideStackBP(data, idx, found, nrRoot, nrRootCopy, roots, rootNum);
+		}
+	}
+	bool CircleBinormal::solveMin(const Circle& a, const Circle& b, const Transform& tA, const Transform& tB, Binormal& bin, Real bound, Real precision) {
+		return solveMin(a, b, tA, tB, getWorkspace(), bin, bound, precision);
+	}
+	bool CircleBinormal::solveMin(const CircularArc& a, const CircularArc& b, const Transform& tA, const Transform& tB, Binormal& bin, Real bound, Real precision) {
+		return solveMin(a, b, tA, tB, getWorkspace(), bin, bound, precision);
+	}
+	bool CircleBinormal::solveMin(const Circle& a, const Circle& b, const Transform& btoa, Binormal& bin, Real bound, Real precision) {
+		return solveMin(a, b, btoa, getWorkspace(), bin, bound, precision);
+	}
+	bool CircleBinormal::solveMin(const CircularArc& a, const CircularArc& b, const Transform& btoa, Binormal& bin, Real bound, Real precision) {
+		return solveMin(a, b, btoa, getWorkspace(), bin, bound, precision);
+	}
+	bool CircleBinormal::solveMin(const Circle& a, const Circle& b, const Transform& tA, const Transform& tB, Workspace& ws, Binormal& bin, Real bound, Real precision) {
 		Transform btoa = Transform::connect(tB, tA);
-		const auto& bDomain = b.domain;
-		//Binormal bin;
+		return solveMin(a, b, btoa, ws, bin, bound, precision);
+	}
+	bool CircleBinormal::solveMin(const CircularArc& a, const CircularArc& b, const Transform& tA, const Transform& tB, Workspace& ws, Binormal& bin, Real bound, Real precision) {
+		Transform btoa = Transform::connect(tB, tA);
+		return solveMin(a, b, btoa, ws, bin, bound, precision);
+	}
+	bool CircleBinormal::solveMin(const Circle& a, const Circle& b, const Transform& btoa, Workspace& ws, Binormal& bin, Real bound, Real precision) {
+		CircularArc arcA, arcB;
+		arcA.radius = a.radius;
+		arcB.radius = b.radius;
+		arcA.domain = piDomain::create(0, PI20);
+		arcB.domain = piDomain::create(0, PI20);
+
+		return solveMin(arcA, arcB, btoa, ws, bin, bound, precision);
+	}
+	bool CircleBinormal::solveMin(const CircularArc& a, const CircularArc& b, const Transform& btoa, Workspace& ws, Binormal& bin, Real bound, Real precision) {
+		// For numerical stability, scale circles to make average radius to be 1.0
+		Real avgRadius = (a.radius + b.radius) * 0.5;
+
+		Transform nbtoa = btoa;
+		nbtoa.T /= avgRadius;
+
+		CircularArc arcA = a, arcB = b;
+		arcA.radius = a.radius / avgRadius;
+		arcB.radius = b.radius / avgRadius;
+
+		Real nbound = bound / avgRadius;
+		bin.distance = nbound;
+
+		/* Check for exceptional cases */
+		// Exception 1
+		if (exceptionA(arcA, arcB, nbtoa)) {
+			Real d = sqrt(SQ(arcA.radius - arcB.radius) + SQ(nbtoa.T[2]));
+			if (d >= nbound)
+				return false;
+			bin.type = 1;
+			bin.distance = d * avgRadius;
+			return true;
+		}
+
+		// Exception 2
+		ws.exceptionBins.clear();
+		exceptionB(arcA, arcB, nbtoa, ws.exceptionBins);
+		for (auto& ebin : ws.exceptionBins) {
+			if (ebin.distance < bin.distance)
+				bin = ebin;
+		}
+
+		// Set domains to solve 8-th degree polynomial
+		Domain aCosDom, bCosDom;
+		Real aBegCos = cos(a.domain.beg()), aEndCos = cos(a.domain.end());
+		Real bBegCos = cos(b.domain.beg()), bEndCos = cos(b.domain.end());
+
+		Real beg, end;
+		if (a.domain.has(PI)) beg = -1.0;
+		else beg = (aBegCos < aEndCos) ? aBegCos : aEndCos;
+		if (a.domain.has(0.0)) end = 1.0;
+		else end = (aBegCos > aEndCos) ? aBegCos : aEndCos;
+		aCosDom.set(beg, end);
+
+		if (b.domain.has(PI)) beg = -1.0;
+		else beg = (bBegCos < bEndCos) ? bBegCos : bEndCos;
+		if (b.domain.has(0.0)) end = 1.0;
+		else end = (bBegCos > bEndCos) ? bBegCos : bEndCos;
+		bCosDom.set(beg, end);
+
+		// Solve 8-th degree polynomial of the circle with smaller domain
+		if (aCosDom.width() >= bCosDom.width())
+			subroutineMin(arcA, arcB, nbtoa, &bCosDom, 1, ws, bin, precision);
+		else {
+			Binormal rbin;
+			rbin.distance = bin.distance;
+			subroutineMin(arcB, arcA, nbtoa.inverse(), &aCosDom, 1, ws, rbin, precision);
+			if (rbin.distance < bin.distance) {
+				bin = rbin;
+				swapBinormal(bin);
+			}
+		}
+		if (!(bin.distance < nbound))
+			return false;
+
+		// Recover real radius and distance
+		bin.pointA *= avgRadius;
+		bin.pointB *= avgRadius;
+		bin.distance *= avgRadius;
+		return true;
+	}
 
-		for (int i = 0; i <= sampleNum; i++) {
-			Real bt = bDomain.beg() + bDomain.width() * ((Real)i / (Real)sampleNum);
-			bruteSolveAtGivenBParam(a, b, bt, btoa, bins, precision);
+	// Max-distance solve
+	// Distance between circle [ a ] and its farthest point from [ pt ] in [ a ]'s local coordinates
+	inline static Real pointCircleFarDistance(const Circle& a, const Vec3& pt) {
+		Real rho = sqrt(pt[0] * pt[0] + pt[1] * pt[1]) + a.radius;
+		return sqrt(rho * rho + pt[2] * pt[2]);
+	}
+	// Upper bound of distance between circle [ a ] and points on circle [ b ] whose parameter has cosine in [ cosBeg, cosEnd ]
+	// Farthest distance to a circle is 1-Lipschitz as well, so distance from the middle point of each arc plus its half chord is an upper bound
+	inline static Real binormalUpperBound(const CircularArc& a, const CircularArc& b, const Transform& btoa, Real cosBeg, Real cosEnd) {
+		Real uBeg = acos(cosEnd), uEnd = acos(cosBeg);
+		Real uMid = (uBeg + uEnd) * 0.5;
+		Real halfChord = 2.0 * b.radius * sin((uEnd - uBeg) * 0.25);
+
+		Real bound = 0.0;
+		for (int i = 0; i < 2; i++) {
+			Real d = pointCircleFarDistance(a, btoa.apply(b.evaluate(i == 0 ? uMid : -uMid)));
+			if (d > bound)
+				bound = d;
+		}
+		return bound + halfChord;
+	}
+	// Upper bound of [ binormalUpperBound ] for domain of Bezier polynomial [ M ]
+	inline static Real binormalUpperBound(const CircularArc& a, const CircularArc& b, const Transform& btoa, const CircleBinormal::BP& M) {
+		Real cosBeg = recoverRootBP(M.domain[0]);
+		Real cosEnd = recoverRootBP(M.domain[1]);
+		if (cosBeg < -1) cosBeg = -1;
+		if (cosEnd > 1) cosEnd = 1;
+		return binormalUpperBound(a, b, btoa, cosBeg, cosEnd);
+	}
+	// Refine potential binormals for given [ cosB ] parameter, and keep the longest one in [ bin ]
+	// @aCopy, bCopy : [ a ], [ b ] with slightly extended domains
+	inline static void updateMaxBinormal(const CircularArc& a, const CircularArc& b, const CircularArc& aCopy, const CircularArc& bCopy, const Transform& btoa, Real cosB, CircleBinormal::Binormal& bin, Real precision) {
+		if (fabs(cosB) > 1 + TOL) return;
+		else if (cosB > 1)	cosB = 1;
+		else if (cosB < -1) cosB = -1;
+
+		CircleBinormal::Binormal tmpBins[4], nbin;
+		int tnum;
+		findPotBinormal(aCopy, bCopy, btoa, cosB, tmpBins, tnum);
+		for (int i = 0; i < tnum; i++) {
+			// Binormal through [ B(paramB) ] cannot be longer than distance from that point to the farthest point of circle [ a ]
+			if (pointCircleFarDistance(a, btoa.apply(b.evaluate(tmpBins[i].paramB))) <= bin.distance - PROJECTION_EPS)
+				continue;
+			Real param[3] = { 0, tmpBins[i].paramA, tmpBins[i].paramB };
+			bool success = binormalNR(a, b, btoa, param, precision);
+			if (!success || !a.domain.has(param[1]) || !b.domain.has(param[2]))
+				continue;
+			makeBinormal(a, b, btoa, param[1], param[2], nbin);
+			if (nbin.distance > bin.distance)
+				bin = nbin;
 		}
 	}
+	void CircleBinormal::subroutineMax(const CircularArc& a, const CircularArc& b, const Transform& btoa, const Domain bCosDomains[], int bCosDomainNum, Workspace& ws, Binormal& bin, Real precision) {
+		// Assume [ a ] is located on XY plane.
+		Real C[3], U[3], V[3];	// Center, orthonormal direction of [ b ] in [ a ]'s local coordinates.
+		for (int i = 0; i < 3; i++) {
+			C[i] = btoa.T[i];
+			U[i] = btoa.R[i][0];
+			V[i] = btoa.R[i][1];
+		}
+		CircularArc aCopy = a, bCopy = b;
+		extendArcDomain(aCopy);
+		extendArcDomain(bCopy);
+
+		Real roots[maxRootNum];
+		int rootNum;
+		if (closedFormRoots(a, b, C, U, V, bCosDomains, bCosDomainNum, roots, rootNum)) {
+			for (int i = 0; i < rootNum; i++)
+				updateMaxBinormal(a, b, aCopy, bCopy, btoa, roots[i], bin, precision);
+			return;
+		}
+
+		Real coef[9];
+		binormalPolynomial(b.radius, a.radius, C, U, V, coef);
 
-	static void bruteSolveAtGivenParam(const CircularArc& a, const CircularArc& b, Real aparam, Real bparam, const Transform& btoa, std::vector<CircleBinormal::Binormal>& bins, Real precision) {
-		Real param[3], fvec[3], dvec[3], djac[3][3];
-		param[1] = aparam;
-		param[2] = bparam;
-		Real dist = binormalNRFunc(param, fvec, dvec, djac, a, b, btoa);
-		if (dist < PROXIMITY_EPS)
-			safeAddBinormal(a, b, btoa, aparam, bparam, bins);
+		BP* data = ws.data;
+		BP m = initBP(coef, bCosDomains, bCosDomainNum, ws.validDomains);
+		ws.validDomainNum = bCosDomainNum;
+
+		rootNum = 0;
+		factorEndsBP(m, roots, rootNum);
+
+		// Same as [ subroutineMin ], but domains that cannot have longer binormal are discarded
+		int idx = (m.degree == 0) ? -1 : 0;
+		data[0] = m;
+		while (true) {
+			bool searching = popStackBP(data, idx, ws.validDomains, ws.validDomainNum, roots, rootNum);
+			for (int i = 0; i < rootNum; i++)
+				updateMaxBinormal(a, b, aCopy, bCopy, btoa, recoverRootBP(roots[i]), bin, precision);
+			rootNum = 0;
+			if (!searching)
+				break;
+
+			if (binormalUpperBound(a, b, btoa, data[idx]) <= bin.distance) {
+				idx--;
+				continue;
+			}
+			Real nrRoot = estimateBP(data[idx]);
+			Real nrRootCopy = nrRoot;
+
+			setDcoefsBP(data[idx]);	// Have to get ready derivative coefficients before NR
+			bool found = solveNR(data[idx], nrRoot);
+			subdivideStackBP(data, idx, found, nrRoot, nrRootCopy, roots, rootNum);
+		}
+	}
+	bool CircleBinormal::solveMax(const Circle& a, const Circle& b, const Transform& tA, const Transform& tB, Binormal& bin, Real bound, Real precision) {
+		return solveMax(a, b, tA, tB, getWorkspace(), bin, bound, precision);
+	}
+	bool CircleBinormal::solveMax(const CircularArc& a, const CircularArc& b, const Transform& tA, const Transform& tB, Binormal& bin, Real bound, Real precision) {
+		return solveMax(a, b, tA, tB, getWorkspace(), bin, bound, precision);
+	}
+	bool CircleBinormal::solveMax(const Circle& a, const Circle& b, const Transform& btoa, Binormal& bin, Real bound, Real precision) {
+		return solveMax(a, b, btoa, getWorkspace(), bin, bound, precision);
+	}
+	bool CircleBinormal::solveMax(const CircularArc& a, const CircularArc& b, const Transform& btoa, Binormal& bin, Real bound, Real precision) {
+		return solveMax(a, b, btoa, getWorkspace(), bin, bound, precision);
+	}
+	bool CircleBinormal::solveMax(const Circle& a, const Circle& b, const Transform& tA, const Transform& tB, Workspace& ws, Binormal& bin, Real bound, Real precision) {
+		Transform btoa = Transform::connect(tB, tA);
+		return solveMax(a, b, btoa, ws, bin, bound, precision);
+	}
+	bool CircleBinormal::solveMax(const CircularArc& a, const CircularArc& b, const Transform& tA, const Transform& tB, Workspace& ws, Binormal& bin, Real bound, Real precision) {
+		Transform btoa = Transform::connect(tB, tA);
+		return solveMax(a, b, btoa, ws, bin, bound, precision);
+	}
+	bool CircleBinormal::solveMax(const Circle& a, const Circle& b, const Transform& btoa, Workspace& ws, Binormal& bin, Real bound, Real precision) {
+		CircularArc arcA, arcB;
+		arcA.radius = a.radius;
+		arcB.radius = b.radius;
+		arcA.domain = piDomain::create(0, PI20);
+		arcB.domain = piDomain::create(0, PI20);
+
+		return solveMax(arcA, arcB, btoa, ws, bin, bound, precision);
+	}
+	bool CircleBinormal::solveMax(const CircularArc& a, const CircularArc& b, const Transform& btoa, Workspace& ws, Binormal& bin, Real bound, Real precision) {
+		// For numerical stability, scale circles to make average radius to be 1.0
+		Real avgRadius = (a.radius + b.radius) * 0.5;
+
+		Transform nbtoa = btoa;
+		nbtoa.T /= avgRadius;
+
+		CircularArc arcA = a, arcB = b;
+		arcA.radius = a.radius / avgRadius;
+		arcB.radius = b.radius / avgRadius;
+
+		Real nbound = bound / avgRadius;
+		bin.distance = nbound;
+
+		/* Check for exceptional cases */
+		// Exception 1
+		if (exceptionA(arcA, arcB, nbtoa)) {
+			Real d = sqrt(SQ(arcA.radius + arcB.radius) + SQ(nbtoa.T[2]));
+			if (d <= nbound)
+				return false;
+			bin.type = 1;
+			bin.distance = d * avgRadius;
+			return true;
+		}
+
+		// Exception 2
+		ws.exceptionBins.clear();
+		exceptionB(arcA, arcB, nbtoa, ws.exceptionBins);
+		for (auto& ebin : ws.exceptionBins) {
+			if (ebin.distance > bin.distance)
+				bin = ebin;
+		}
+
+		// Set domains to solve 8-th degree polynomial
+		Domain aCosDom, bCosDom;
+		Real aBegCos = cos(a.domain.beg()), aEndCos = cos(a.domain.end());
+		Real bBegCos = cos(b.domain.beg()), bEndCos = cos(b.domain.end());
+
+		Real beg, end;
+		if (a.domain.has(PI)) beg = -1.0;
+		else beg = (aBegCos < aEndCos) ? aBegCos : aEndCos;
+		if (a.domain.has(0.0)) end = 1.0;
+		else end = (aBegCos > aEndCos) ? aBegCos : aEndCos;
+		aCosDom.set(beg, end);
+
+		if (b.domain.has(PI)) beg = -1.0;
+		else beg = (bBegCos < bEndCos) ? bBegCos : bEndCos;
+		if (b.domain.has(0.0)) end = 1.0;
+		else end = (bBegCos > bEndCos) ? bBegCos : bEndCos;
+		bCosDom.set(beg, end);
+
+		// Solve 8-th degree polynomial of the circle with smaller domain
+		if (aCosDom.width() >= bCosDom.width())
+			subroutineMax(arcA, arcB, nbtoa, &bCosDom, 1, ws, bin, precision);
 		else {
-			Real det = fabs(fvec[1]) + fabs(fvec[1]);
-			if (det < 0.2) {	// Only if current parameters give approximate binormals
-				bool success = binormalNR(a, b, btoa, param, precision);
-				if (success && a.domain.has(param[1]) && b.domain.has(param[2]))
-					safeAddBinormal(a, b, btoa, param[1], param[2], bins);
+			Binormal rbin;
+			rbin.distance = bin.distance;
+			subroutineMax(arcB, arcA, nbtoa.inverse(), &aCosDom, 1, ws, rbin, precision);
+			if (rbin.distance > bin.distance) {
+				bin = rbin;
+				swapBinormal(bin);
 			}
 		}
+		if (!(bin.distance > nbound))
+			return false;
+
+		// Recover real radius and distance
+		bin.pointA *= avgRadius;
+		bin.pointB *= avgRadius;
+		bin.distance *= avgRadius;
+		return true;
 	}
-	static void bruteSolveAtGivenBParam(const CircularArc& a, const CircularArc& b, Real bparam, const Transform& btoa, std::vector<CircleBinormal::Binormal>& bins, Real precision) {
-		auto bpt = b.evaluate(bparam);
-		bpt = btoa.apply(bpt);
 
-		Real minp, maxp;
-		a.Circle::findExtDistParam(bpt, minp, maxp);
+	// Track
+	// Change of relative transform : Translation scaled by [ scale ] + Maximum change of rotation matrix element
+	inline static Real transformJump(const Transform& prev, const Transform& curr, Real scale) {
+		Real jump = 0, diff;
+		for (int i = 0; i < 3; i++) {
+			for (int j = 0; j < 3; j++) {
+				diff = fabs(prev.R[i][j] - curr.R[i][j]);
+				if (diff > jump) jump = diff;
+			}
+		}
+		return jump + (prev.T - curr.T).len() / scale;
+	}
+	// Count distinct real roots of monomial [ coef ] in [ -1, 1 ] with Sturm sequence
+	// @ret : -1 if polynomial is degenerate
+	inline static int sturmRootNum(const Real coef[9]) {
+		Real seq[9][9];		// seq[k] : k-th polynomial of Sturm sequence
+		int degree[9];
+		int num = 0;
+
+		degree[0] = 8;
+		while (degree[0] > 0 && fabs(coef[degree[0]]) < ROOT_EPS)
+			degree[0]--;
+		if (degree[0] == 0)
+			return -1;
+		for (int i = 0; i <= degree[0]; i++)
+			seq[0][i] = coef[i];
+		degree[1] = degree[0] - 1;
+		for (int i = 0; i <= degree[1]; i++)
+			seq[1][i] = coef[i + 1] * (i + 1);
+		num = 2;
+
+		// seq[k + 1] = -remainder(seq[k - 1] / seq[k])
+		while (degree[num - 1] > 0) {
+			const Real* p = seq[num - 2];
+			const Real* q = seq[num - 1];
+			int dp = degree[num - 2], dq = degree[num - 1];
+			Real r[9], scale = 0;
+			for (int i = 0; i <= dp; i++) {
+				r[i] = p[i];
+				if (fabs(p[i]) > scale) scale = fabs(p[i]);
+			}
+			for (int i = dp; i >= dq; i--) {
+				Real f = r[i] / q[dq];
+				for (int j = 0; j <= dq; j++)
+					r[i - dq + j] -= f * q[j];
+			}
+			int dr = dq - 1;
+			while (dr >= 0 && fabs(r[dr]) <= scale * STURM_EPS)
+				dr--;
+			if (dr < 0)
+				break;	// Multiple root : Remaining sequence is divisible by gcd, which does not change sign count
+			degree[num] = dr;
+			for (int i = 0; i <= dr; i++)
+				seq[num][i] = -r[i];
+			num++;
+		}
 
-		bruteSolveAtGivenParam(a, b, minp, bparam, btoa, bins, precision);
-		bruteSolveAtGivenParam(a, b, maxp, bparam, btoa, bins, precision);
+		// Number of sign changes at both ends
+		int change[2] = { 0, 0 };
+		for (int e = 0; e < 2; e++) {
+			Real x = (e == 0) ? -1.0 : 1.0, prev = 0;
+			for (int k = 0; k < num; k++) {
+				Real v = 0;
+				for (int i = degree[k]; i >= 0; i--)
+					v = v * x + seq[k][i];
+				if (v == 0)
+					continue;
+				if (prev * v < 0)
+					change[e]++;
+				prev = v;
+			}
+		}
+		return change[0] - change[1];
+	}
+	// Number of real roots of 8-th degree binormal polynomial of full circles [ a ] and [ b ]
+	inline static int binormalRootNum(const Circle& a, const Circle& b, const Transform& btoa) {
+		Real avgRadius = (a.radius + b.radius) * 0.5;
+		Real C[3], U[3], V[3];
+		for (int i = 0; i < 3; i++) {
+			C[i] = btoa.T[i] / avgRadius;
+			U[i] = btoa.R[i][0];
+			V[i] = btoa.R[i][1];
+		}
+		Real coef[9];
+		binormalPolynomial(b.radius / avgRadius, a.radius / avgRadius, C, U, V, coef);
+		return sturmRootNum(coef);
+	}
+	// Refine binormals of full circles in [ tracker ] under [ btoa ]
+	// @ret : False if any of them cannot be tracked reliably
+	inline static bool trackBinormals(const CircularArc& a, const CircularArc& b, const Transform& btoa, CircleBinormal::Tracker& tracker, Real precision) {
+		// Work in scaled coordinates as [ solve ] does
+		Real avgRadius = (a.radius + b.radius) * 0.5;
+		if (transformJump(tracker.btoa, btoa, avgRadius) > tracker.maxJump)
+			return false;
+
+		Transform nbtoa = btoa;
+		nbtoa.T /= avgRadius;
+
+		CircularArc arcA, arcB;
+		arcA.radius = a.radius / avgRadius;
+		arcB.radius = b.radius / avgRadius;
+		arcA.domain = piDomain::create(0, PI20);
+		arcB.domain = piDomain::create(0, PI20);
+
+		std::vector<CircleBinormal::Binormal> nbins;
+		nbins.reserve(tracker.bins.size());
+		for (auto& bin : tracker.bins) {
+			Real param[3] = { 0, bin.paramA, bin.paramB };
+			if (!binormalNR(arcA, arcB, nbtoa, param, precision))
+				return false;
+
+			// Near intersection or nearly singular Hessian, binormals could appear or vanish
+			Real fvec[3], dvec[3], djac[3][3];
+			Real d = binormalNRFunc(param, fvec, dvec, djac, arcA, arcB, nbtoa);
+			if (d < PROXIMITY_EPS2 || fabs(djac[1][1] * djac[2][2] - djac[1][2] * djac[2][1]) < tracker.degenerateEps)
+				return false;
+
+			// Two binormals converged to the same one
+			size_t prevNum = nbins.size();
+			safeAddBinormal(arcA, arcB, nbtoa, param[1], param[2], nbins);
+			if (nbins.size() == prevNum)
+				return false;
+		}
+		for (auto& bin : nbins) {
+			bin.pointA *= avgRadius;
+			bin.pointB *= avgRadius;
+			bin.distance *= avgRadius;
+		}
+		tracker.bins.swap(nbins);
+		return true;
+	}
+	void CircleBinormal::track(const CircularArc& a, const CircularArc& b, const Transform& tA, const Transform& tB, Tracker& tracker, std::vector<Binormal>& bins, Real precision) {
+		track(a, b, tA, tB, tracker, getWorkspace(), bins, precision);
+	}
+	void CircleBinormal::track(const CircularArc& a, const CircularArc& b, const Transform& btoa, Tracker& tracker, std::vector<Binormal>& bins, Real precision) {
+		track(a, b, btoa, tracker, getWorkspace(), bins, precision);
+	}
+	void CircleBinormal::track(const CircularArc& a, const CircularArc& b, const Transform& tA, const Transform& tB, Tracker& tracker, Workspace& ws, std::vector<Binormal>& bins, Real precision) {
+		Transform btoa = Transform::connect(tB, tA);
+		track(a, b, btoa, tracker, ws, bins, precision);
+	}
+	void CircleBinormal::track(const CircularArc& a, const CircularArc& b, const Transform& btoa, Tracker& tracker, Workspace& ws, std::vector<Binormal>& bins, Real precision) {
+		bool tracked = tracker.valid && tracker.radiusA == a.radius && tracker.radiusB == b.radius;
+		int rootNum = -1;
+		if (tracked) {
+			// If number of real roots of binormal polynomial changes, binormals could appear or vanish anywhere
+			rootNum = binormalRootNum(a, b, btoa);
+			tracked = (rootNum >= 0 && rootNum == tracker.rootNum);
+		}
+		if (tracked) {
+			// Configurations that [ solve ] treats as exceptions cannot be tracked
+			Real avgRadius = (a.radius + b.radius) * 0.5;
+			Transform nbtoa = btoa;
+			nbtoa.T /= avgRadius;
+
+			CircularArc arcA, arcB;
+			arcA.radius = a.radius / avgRadius;
+			arcB.radius = b.radius / avgRadius;
+			arcA.domain = piDomain::create(0, PI20);
+			arcB.domain = piDomain::create(0, PI20);
+
+			if (exceptionA(arcA, arcB, nbtoa))
+				tracked = false;
+			else {
+				ws.exceptionBins.clear();
+				exceptionB(arcA, arcB, nbtoa, ws.exceptionBins);
+				tracked = ws.exceptionBins.empty() && trackBinormals(a, b, btoa, tracker, precision);
+			}
+		}
+		if (tracked)
+			tracker.trackNum++;
+		else {
+			Circle circleA, circleB;
+			circleA.radius = a.radius;
+			circleB.radius = b.radius;
+			solve(circleA, circleB, btoa, ws, tracker.bins, true, precision);
+			tracker.solveNum++;
+			if (rootNum < 0)
+				rootNum = binormalRootNum(a, b, btoa);
+		}
+
+		tracker.radiusA = a.radius;
+		tracker.radiusB = b.radius;
+		tracker.btoa = btoa;
+		tracker.rootNum = rootNum;
+		tracker.valid = (rootNum >= 0);
+		for (auto& bin : tracker.bins) {
+			if (bin.type != 0) {
+				tracker.valid = false;	// Exceptional binormals are not tracked
+				break;
+			}
+		}
+
+		// Binormals of arcs are those of full circles in their domains
+		bins.clear();
+		for (auto& bin : tracker.bins) {
+			if (bin.type == 1 || (a.domain.has(bin.paramA) && b.domain.has(bin.paramB)))
+				bins.push_back(bin);
+		}
+	}
+
+	// Batch
+	void CircleBinormal::buildPolynomials(const PairBatch& batch, Real coefs[]) {
+		// Pairs are independent and [ binormalPolynomial ] has no branch, so this loop is vectorized over pairs
+		for (int i = 0; i < batch.num; i++) {
+			// For numerical stability, scale circles to make average radius to be 1.0
+			Real invRadius = 2.0 / (batch.radiusA[i] + batch.radiusB[i]);
+			Real C[3], U[3], V[3];
+			for (int j = 0; j < 3; j++) {
+				C[j] = batch.center[j][i] * invRadius;
+				U[j] = batch.axisU[j][i];
+				V[j] = batch.axisV[j][i];
+			}
+			binormalPolynomial(batch.radiusB[i] * invRadius, batch.radiusA[i] * invRadius, C, U, V, &coefs[i * 9]);
+		}
+	}
+	// Set [ i ]-th pair of [ batch ] as full circles, scaled to make average radius to be 1.0 as in scalar [ solve ]
+	// @ret : Average radius of the pair
+	inline static Real batchPair(const CircleBinormal::PairBatch& batch, int i, CircularArc& arcA, CircularArc& arcB, Transform& nbtoa) {
+		Real avgRadius = (batch.radiusA[i] + batch.radiusB[i]) * 0.5;
+		arcA.radius = batch.radiusA[i] / avgRadius;
+		arcB.radius = batch.radiusB[i] / avgRadius;
+
+		Vec3 U, V, W;
+		for (int j = 0; j < 3; j++) {
+			nbtoa.T[j] = batch.center[j][i] / avgRadius;
+			U[j] = batch.axisU[j][i];
+			V[j] = batch.axisV[j][i];
+		}
+		W = U.cross(V);
+		for (int j = 0; j < 3; j++) {
+			nbtoa.R[j][0] = U[j];
+			nbtoa.R[j][1] = V[j];
+			nbtoa.R[j][2] = W[j];
+		}
+		return avgRadius;
+	}
+	void CircleBinormal::solve(const PairBatch& batch, BatchWorkspace& ws, std::vector<Binormal> bins[], bool refine, Real precision) {
+		static const int blockSize = 64;	// Number of polynomials built and solved at once
+		Real coefs[blockSize * 9];
+		Real roots[blockSize * maxRootNum];			// Roots of general pairs, in order of [ coefs ]
+		int rootNum[blockSize];
+		Real closedRoots[blockSize * maxRootNum];	// Roots of pairs in special configurations, found in closed form
+		int closedRootNum[blockSize];
+		int type[blockSize];						// 0 : General pair, 1 : Coaxial pair ( exceptionA ), 2 : Roots found in closed form
+
+		CircularArc arcA, arcB;
+		arcA.domain.set(0, PI20);
+		arcB.domain.set(0, PI20);
+		Domain bCosDom;
+		bCosDom.set(-1.0, 1.0);
+		Transform nbtoa;
+
+		for (int beg = 0; beg < batch.num; beg += blockSize) {
+			PairBatch block = batch;
+			block.num = (batch.num - beg < blockSize) ? (batch.num - beg) : blockSize;
+			block.radiusA += beg;
+			block.radiusB += beg;
+			for (int j = 0; j < 3; j++) {
+				block.center[j] += beg;
+				block.axisU[j] += beg;
+				block.axisV[j] += beg;
+			}
+			buildPolynomials(block, coefs);
+
+			// Classify pairs as scalar [ subroutine ] does, and only leave general pairs in [ coefs ]
+			int generalNum = 0;
+			for (int i = 0; i < block.num; i++) {
+				batchPair(block, i, arcA, arcB, nbtoa);
+				if (exceptionA(arcA, arcB, nbtoa)) {
+					type[i] = 1;
+					continue;
+				}
+				Real C[3], U[3], V[3];
+				for (int j = 0; j < 3; j++) {
+					C[j] = nbtoa.T[j];
+					U[j] = nbtoa.R[j][0];
+					V[j] = nbtoa.R[j][1];
+				}
+				if (closedFormRoots(arcA, arcB, C, U, V, &bCosDom, 1, &closedRoots[i * maxRootNum], closedRootNum[i])) {
+					type[i] = 2;
+					continue;
+				}
+				type[i] = 0;
+				if (generalNum != i)
+					memcpy(&coefs[generalNum * 9], &coefs[i * 9], sizeof(Real) * 9);
+				generalNum++;
+			}
+			solvePolynomials(generalNum, coefs, &bCosDom, 1, roots, rootNum, ws);
+
+			// Refinement is done for each pair
+			int general = 0;
+			for (int i = 0; i < block.num; i++) {
+				std::vector<Binormal>& pbins = bins[beg + i];
+				Real avgRadius = batchPair(block, i, arcA, arcB, nbtoa);
+
+				pbins.clear();
+				// Exception 1
+				if (type[i] == 1) {
+					Binormal bin;
+					bin.type = 1;
+					pbins.push_back(bin);
+					continue;
+				}
+				// Exception 2
+				exceptionB(arcA, arcB, nbtoa, pbins);
+
+				if (type[i] == 2)
+					processRoots(arcA, arcB, nbtoa, &closedRoots[i * maxRootNum], closedRootNum[i], pbins, refine, precision);
+				else {
+					processRoots(arcA, arcB, nbtoa, &roots[general * maxRootNum], rootNum[general], pbins, refine, precision);
+					general++;
+				}
+
+				for (auto& bin : pbins) {
+					bin.pointA *= avgRadius;
+					bin.pointB *= avgRadius;
+					bin.distance *= avgRadius;
+				}
+			}
+		}
+	}
+
+	// Brute Solve
+	static void bruteSolveNR(const Circle& a, const Circle& b, const Transform& btoa, int num, Real x[], Real y[], int state[], Real precision);
+	void CircleBinormal::bruteSolve(const CircularArc& a, const CircularArc& b, const Transform& tA, const Transform& tB, std::vector<Binormal>& bins, Real precision, int sampleNum) {
+		Transform btoa = Transform::connect(tB, tA);
+		const auto& bDomain = b.domain;
+		const Real
+			bbeg = bDomain.beg(),
+			bstep = bDomain.width() / (Real)sampleNum,
+			r00 = btoa.R[0][0] * b.radius,
+			r01 = btoa.R[0][1] * b.radius,
+			r10 = btoa.R[1][0] * b.radius,
+			r11 = btoa.R[1][1] * b.radius,
+			t0 = btoa.T[0],
+			t1 = btoa.T[1];
+		// Two starting parameter pairs for each sample : Closest and farthest points on [ a ] from the sample point
+		Real x[BRUTE_CHUNK * 2], y[BRUTE_CHUNK * 2];
+		int state[BRUTE_CHUNK * 2];
+
+		// Samples are processed in chunks of [ BRUTE_CHUNK ] in SoA layout, and results are added in order of samples
+		for (int beg = 0; beg <= sampleNum; beg += BRUTE_CHUNK) {
+			int num = std::min(BRUTE_CHUNK, sampleNum + 1 - beg);
+
+			// Project sample points of [ b ] onto [ a ] ( same as Circle::findExtDistParam, without branches )
+			for (int i = 0; i < num; i++) {
+				Real bt = bbeg + bstep * (Real)(beg + i);
+				Real c = cos(bt), s = sin(bt);
+				Real px = r00 * c + r01 * s + t0;
+				Real py = r10 * c + r11 * s + t1;
+				Real t = atan2(py, px);
+				t += (t < 0) ? PI20 : 0;
+				Real u = t + PI;
+				u -= (u >= PI20) ? PI20 : 0;
+				x[i * 2] = t;
+				x[i * 2 + 1] = u;
+				y[i * 2] = bt;
+				y[i * 2 + 1] = bt;
+			}
+			bruteSolveNR(a, b, btoa, num * 2, x, y, state, precision);
+			for (int i = 0; i < num * 2; i++) {
+				if (state[i] == 2 || (state[i] == 1 && a.domain.has(x[i]) && b.domain.has(y[i])))
+					safeAddBinormal(a, b, btoa, x[i], y[i], bins);
+			}
+		}
+	}
+	// Refine [ num ] starting parameters [ x, y ] ( on [ a ], [ b ] ) by NR on binormal equations ( same as [ binormalNRFunc ] and [ binormalNR ] )
+	// Parameters are refined in lockstep, and NR step runs over lanes without branches, so that it is vectorized
+	// ( GCC needs -O3 with -fno-math-errno and -fno-trapping-math, and [ sin ], [ cos ] stay scalar unless math library offers vector versions )
+	// After each step, lanes that are done are removed, so that work is proportional to the lanes still running
+	// @state : 0 = Not a binormal, 1 = Binormal found by NR, 2 = Two points meet at starting parameters
+	static void bruteSolveNR(const Circle& a, const Circle& b, const Transform& btoa, int num, Real x[], Real y[], int state[], Real precision) {
+		const Real
+			ra = a.radius,
+			rb = b.radius,
+			r00 = btoa.R[0][0], r01 = btoa.R[0][1],
+			r10 = btoa.R[1][0], r11 = btoa.R[1][1],
+			r20 = btoa.R[2][0], r21 = btoa.R[2][1],
+			t0 = btoa.T[0], t1 = btoa.T[1], t2 = btoa.T[2];
+		int id[BRUTE_CHUNK * 2];			// Index of parameters that each lane is refining
+		Real running[BRUTE_CHUNK * 2];		// Masks are kept as [ Real ] 0 or 1 so that they share vector width with parameters
+		Real result[BRUTE_CHUNK * 2];		// [ state ] of each lane
+		Real largerEps[BRUTE_CHUNK * 2];
+		Real eps[BRUTE_CHUNK * 2];
+		Real lx[BRUTE_CHUNK * 2];
+		Real ly[BRUTE_CHUNK * 2];
+		Real cx[BRUTE_CHUNK * 2], sx[BRUTE_CHUNK * 2], cy[BRUTE_CHUNK * 2], sy[BRUTE_CHUNK * 2];
+
+		for (int l = 0; l < num; l++) {
+			id[l] = l;
+			result[l] = 0.0;
+			largerEps[l] = 0.0;
+			eps[l] = precision;
+			lx[l] = x[l];
+			ly[l] = y[l];
+		}
+		int laneNum = num;
+		for (int k = 0; k < NR_MAX_ITER && laneNum > 0; k++) {
+			BINORMAL_STATS_ADD(binormalNRIterNum, laneNum);
+			for (int l = 0; l < laneNum; l++) {
+				cx[l] = cos(lx[l]);
+				sx[l] = sin(lx[l]);
+				cy[l] = cos(ly[l]);
+				sy[l] = sin(ly[l]);
+			}
+			Real first = k == 0 ? 1.0 : 0.0;
+			for (int l = 0; l < laneNum; l++) {
+				// f(x), g(y) and their derivatives in [ a ]'s local coordinates ( f''(x) = -f(x) on XY plane )
+				Real
+					fx0 = ra * cx[l], fx1 = ra * sx[l],
+					dfx0 = -fx1, dfx1 = fx0,
+					bx = rb * cy[l], by = rb * sy[l],
+					gy0 = r00 * bx + r01 * by + t0, gy1 = r10 * bx + r11 * by + t1, gy2 = r20 * bx + r21 * by + t2,
+					dgy0 = r01 * bx - r00 * by, dgy1 = r11 * bx - r10 * by, dgy2 = r21 * bx - r20 * by,
+					diff0 = fx0 - gy0, diff1 = fx1 - gy1, diff2 = -gy2,
+					d = sqrt(diff0 * diff0 + diff1 * diff1 + diff2 * diff2);
+
+				Real dvec1 = dfx0 * diff0 + dfx1 * diff1;
+				Real dvec2 = dgy0 * diff0 + dgy1 * diff1 + dgy2 * diff2;
+				Real errf = fabs(dvec1 / (ra * d)) + fabs(dvec2 / (rb * d));
+
+				Real j11 = ra * ra - (fx0 * diff0 + fx1 * diff1);
+				Real j12 = -(dfx0 * dgy0 + dfx1 * dgy1);
+				Real j21 = -j12;
+				Real j22 = -((gy0 - t0) * diff0 + (gy1 - t1) * diff1 + (gy2 - t2) * diff2) - rb * rb;
+				Real det = j11 * j22 - j12 * j21;
+
+				Real meet = d < PROXIMITY_EPS ? 1.0 : 0.0;					// If two points meet, just regard them as binormal
+				Real far = errf >= BRUTE_NR_FILTER ? first : 0.0;			// Only if starting parameters give approximate binormals
+				Real enlarge = d < PROXIMITY_EPS2 ? (1 - meet) * (1 - largerEps[l]) : 0.0;	// fvec values become unstable as two points get close
+				eps[l] *= enlarge != 0.0 ? 100.0 : 1.0;
+				largerEps[l] += enlarge;
+				Real converged = errf <= eps[l] ? (1 - meet) * (1 - far) : 0.0;
+
+				result[l] = meet != 0.0 ? 1 + first : converged;
+				running[l] = det != 0.0 ? (1 - meet) * (1 - far) * (1 - converged) : 0.0;
+
+				Real invDet = running[l] / (det != 0.0 ? det : 1.0);	// Zero step for lanes that are done
+				lx[l] += (-j22 * dvec1 + j12 * dvec2) * invDet;
+				ly[l] += (j21 * dvec1 - j11 * dvec2) * invDet;
+			}
+
+			// Remove lanes that are done
+			int nextNum = 0;
+			for (int l = 0; l < laneNum; l++) {
+				if (running[l] != 0.0) {
+					id[nextNum] = id[l];
+					largerEps[nextNum] = largerEps[l];
+					eps[nextNum] = eps[l];
+					lx[nextNum] = lx[l];
+					ly[nextNum] = ly[l];
+					nextNum++;
+				}
+				else {
+					state[id[l]] = (int)result[l];
+					x[id[l]] = lx[l];
+					y[id[l]] = ly[l];
+				}
+			}
+			laneNum = nextNum;
+		}
+		for (int l = 0; l < laneNum; l++)
+			state[id[l]] = 0;	// Max iteration
 	}
 }
\ No newline at end of file
@@ -24,7 +24,7 @@ namespace MN {
 								// 0 : Common binormal, which consists of two distinct points from each circle ( or arc )
 								// 1 : When two circles share same axis and center ( on XY plane ), every pair of points can form binormal
 								// 2 : When a point on circle B is on A's center ( in space ) and also has first deriv parallel to A's axis (RARE)
-								//		Then that point can form binormal line with every point on the circle A
+								//		Then that point can form binormal line with every point on the circle A ( [ paramA ] is the beginning of A's domain )
 								// 3 : When a point on circle A is on B's center ( in space ) and also has first deriv parallel to B's axis (RARE)
 								//		Then that point can form binormal line with every point on the circle B
 
@@ -54,25 +54,164 @@ namespace MN {
 				this->degree = bp.degree;
 			}
 		};
+		// Structure of arrays that describes [ num ] full circle pairs, to process them in batch
+		// For i-th pair, circle B has center [ center[0~2][i] ] and X, Y axis [ axisU[0~2][i], axisV[0~2][i] ] in circle A's local coordinates
+		struct PairBatch {
+			int			num = 0;
+			const Real* radiusA;
+			const Real* radiusB;
+			const Real* center[3];
+			const Real* axisU[3];
+			const Real* axisV[3];
+		};
+		// Binormals found by [ exceptionB ], which are kept in a fixed array to avoid allocation
+		// [ b ] meets the axis of [ a ] at most at 2 points, and each of them forms at most 2 binormals ( twice of that is reserved for numerical duplicates )
+		struct ExceptionBinormals {
+			static const int capacity = 8;
+
+			Binormal	data[capacity];
+			int			num = 0;
+
+			inline Binormal* begin() noexcept { return data; }
+			inline Binormal* end() noexcept { return data + num; }
+			inline const Binormal* begin() const noexcept { return data; }
+			inline const Binormal* end() const noexcept { return data + num; }
+			inline bool empty() const noexcept { return num == 0; }
+			inline void clear() noexcept { num = 0; }
+			inline void push_back(const Binormal& bin) noexcept {
+				if (num < capacity)
+					data[num++] = bin;
+			}
+		};
+		// Root solver for 8-th degree polynomial
+		enum class RootSolver {
+			Bezier,			// Bezier subdivision with Newton steps ( default )
+			Descartes,		// Descartes' rule of signs on Bezier coefficients to isolate roots, and bisection to find them
+			Companion		// Eigenvalues of companion matrix
+							// Less accurate than above for clustered roots : A root of multiplicity m is perturbed by about ( machine epsilon )^(1/m),
+							// and nearly double roots could be split into complex pairs that are discarded ( see Benchmark/RootSolverBenchmark.cpp )
+		};
+		// Caller-owned storage for a single solve. Solving with an explicit workspace does not touch any member state
+		// and does not allocate, so one workspace per thread is enough to run solves concurrently.
+		struct Workspace {
+			static const int bpCapacity = 64;		// Depth of Bezier subdivision stack ( worst case depth of subdivision + 3, checked in CircleBinormal.cpp )
+			static const int domainCapacity = 48;	// Maximum number of valid domains ( 3 gaussmap domains X 4 X 4 )
+
+			BP		data[bpCapacity];
+			Domain	validDomains[domainCapacity];
+			int		validDomainNum = 0;
+			ExceptionBinormals	exceptionBins;
+
+			RootSolver	rootSolver = RootSolver::Bezier;	// Root solver to use in [ solve ] ( [ solveMin ] always uses Bezier subdivision )
+		};
+		// Caller-owned storage for batched root isolation. Every lane owns its own subdivision stack,
+		// and [ lanes ] polynomials are processed in lockstep.
+		// It takes about 80 KB, so allocate it on the heap ( e.g. one per thread ) instead of the stack.
+		struct BatchWorkspace {
+			static const int lanes = 8;				// Number of polynomials processed in lockstep
+
+			BP		data[lanes][Workspace::bpCapacity];
+			Domain	validDomains[Workspace::domainCapacity];
+			int		validDomainNum = 0;
+		};
+		static const int maxRootNum = 16;			// Maximum number of roots reported for a single polynomial
+		// Binormals of a circle pair in the previous frame, used to warm start the solve of the next frame
+		// Binormals of full circles are kept, so that binormals entering or leaving arc domains are tracked as well
+		struct Tracker {
+			Real		maxJump = 1e-1;			// If [ btoa ] changes more than this ( translation scaled by average radius + rotation ), solve from scratch
+			Real		degenerateEps = 1e-4;	// If Hessian of squared distance at a binormal is nearly singular, number of binormals could change, so solve from scratch
+
+			bool		valid = false;			// False until the first full solve, or if the previous frame cannot be tracked
+			Real		radiusA = 0;
+			Real		radiusB = 0;
+			Transform	btoa;					// Relative transform of the previous frame
+			int			rootNum = 0;			// Number of real roots of binormal polynomial in the previous frame
+			std::vector<Binormal> bins;			// Binormals of full circles in the previous frame
+
+			int			solveNum = 0;			// Number of full solves
+			int			trackNum = 0;			// Number of warm started solves
+
+			inline void reset() {
+				valid = false;
+			}
+		};
+		// Counters of the internal solve process, to find out where time goes for pathological pairs
+		// Counters are only updated if [ MN_BINORMAL_STATS ] is defined at compile time, so that they cost nothing otherwise
+		// Each thread has its own counters ( see [ stats ] )
+		struct Stats {
+			long long	subdivisionNum = 0;		// Bezier subdivisions
+			long long	purgeNum = 0;			// Bezier domains purged because they cannot have roots
+			long long	solveNRIterNum = 0;		// NR iterations on Bezier polynomials
+			long long	solveNRFailNum = 0;		// NR failures on Bezier polynomials
+			long long	binormalNRIterNum = 0;	// NR iterations on binormal equations
+			long long	binormalNRFailNum = 0;	// NR failures on binormal equations
+			long long	domainEpsRootNum = 0;	// Roots pushed without convergence, because domain got narrower than DOMAIN_EPS
+			long long	exceptionANum = 0;		// Coaxial pairs ( exceptionA )
+			long long	exceptionBNum = 0;		// Points of [ b ] found on the axis of [ a ] ( exceptionB )
+			long long	duplicateNum = 0;		// Binormals discarded as duplicates of the ones already found
+
+			inline void reset() noexcept {
+				*this = Stats();
+			}
+			inline Stats& operator+=(const Stats& s) noexcept {
+				subdivisionNum += s.subdivisionNum;
+				purgeNum += s.purgeNum;
+				solveNRIterNum += s.solveNRIterNum;
+				solveNRFailNum += s.solveNRFailNum;
+				binormalNRIterNum += s.binormalNRIterNum;
+				binormalNRFailNum += s.binormalNRFailNum;
+				domainEpsRootNum += s.domainEpsRootNum;
+				exceptionANum += s.exceptionANum;
+				exceptionBNum += s.exceptionBNum;
+				duplicateNum += s.duplicateNum;
+				return *this;
+			}
+		};
+		// Counters of the calling thread. Read ( and reset ) them after a batch of solves, and sum them up over threads if needed
+		static Stats& stats() noexcept;
 	private:
-		std::vector<BP>		data;
-		std::vector<Domain> validDomains;
+		std::vector<Workspace> workspace;	// Lazily allocated workspace for member solve functions
+
+		inline Workspace& getWorkspace() {
+			if (workspace.empty())
+				workspace.resize(1);
+			return workspace[0];
+		}
 
 		// BP functions
-		BP		initBP(const Real monoCoefs[9], const std::vector<Domain>& domains);
-		void	solveBP(const Real monoCoefs[9], const std::vector<Domain>& domains, Real roots[], int& rootNum);
+		static BP	initBP(const Real monoCoefs[9], const Domain domains[], int domainNum, Domain validDomains[]);
+		static void	solveBP(const Real monoCoefs[9], const Domain domains[], int domainNum, Real roots[], int& rootNum, Workspace& ws);		// Dispatch on [ ws.rootSolver ]
+		static void	solveBPBezier(const Real monoCoefs[9], const Domain domains[], int domainNum, Real roots[], int& rootNum, Workspace& ws);
+		static void	solveBPDescartes(const Real monoCoefs[9], const Domain domains[], int domainNum, Real roots[], int& rootNum, Workspace& ws);
+		static void	solveBPCompanion(const Real monoCoefs[9], const Domain domains[], int domainNum, Real roots[], int& rootNum, Workspace& ws);	// Fall back to Bezier subdivision if QR iteration fails
 
 		// This is where actual search process runs. Assume [ a ] is on XY plane, and [ b ] has smaller domain than [ a ]
-		void	subroutine(const CircularArc& a, const CircularArc& b, const Transform& btoa, const std::vector<Domain>& bCosDomains, std::vector<Binormal>& bins, bool refine = true, Real precision = 1e-10);
+		static void	subroutine(const CircularArc& a, const CircularArc& b, const Transform& btoa, const Domain bCosDomains[], int bCosDomainNum, Workspace& ws, std::vector<Binormal>& bins, bool refine = true, Real precision = 1e-10);
+		// Same as above, but with 8-th degree polynomial [ coef ] that is already built for [ a ] and [ b ]
+		static void	subroutine(const CircularArc& a, const CircularArc& b, const Transform& btoa, const Real coef[9], const Domain bCosDomains[], int bCosDomainNum, Workspace& ws, std::vector<Binormal>& bins, bool refine = true, Real precision = 1e-10);
+		// Same as [ subroutine ], but only keeps binormal shorter than [ bin.distance ] in [ bin ]
+		// Bezier domains that cannot have shorter binormal are discarded before NR
+		static void	subroutineMin(const CircularArc& a, const CircularArc& b, const Transform& btoa, const Domain bCosDomains[], int bCosDomainNum, Workspace& ws, Binormal& bin, Real precision = 1e-10);
+		// Same as [ subroutineMin ], but keeps binormal longer than [ bin.distance ]
+		static void	subroutineMax(const CircularArc& a, const CircularArc& b, const Transform& btoa, const Domain bCosDomains[], int bCosDomainNum, Workspace& ws, Binormal& bin, Real precision = 1e-10);
+		// Find binormals from [ roots ] of 8-th degree polynomial ( cosine of [ b ]'s parameter )
+		static void	processRoots(const CircularArc& a, const CircularArc& b, const Transform& btoa, Real roots[], int rootNum, std::vector<Binormal>& bins, bool refine = true, Real precision = 1e-10);
 	
 		// Exception 1 : If two circles share same axis and center ( on XY plane ), every point on each circle could form binormal
 		//				If that is the case, return true
-		bool exceptionA(const CircularArc& a, const CircularArc& b, const Transform& btoa);
+		static bool exceptionA(const CircularArc& a, const CircularArc& b, const Transform& btoa);
 
 		// Exception 2 : If arc B goes through axis of arc A, the rendeavue point could generate a binormal that is not detected by following procedure
 		//				Therefore, detect those cases in advance
-		void exceptionB(const CircularArc& a, const CircularArc& b, const Transform& btoa, std::vector<Binormal>& bins);
+		// @Bins : std::vector of binormals, or [ ExceptionBinormals ]
+		template<typename Bins>
+		static void exceptionB(const CircularArc& a, const CircularArc& b, const Transform& btoa, Bins& bins);
 	public:
+		// Set root solver used by member solve functions
+		inline void setRootSolver(RootSolver solver) {
+			getWorkspace().rootSolver = solver;
+		}
+
 		// Find binormals between two circles ( or arcs )
 		// @tA, tB :	Transformations that map circle [ a, b ] to global coordinates
 		// @bins :		Result binormals. It contains point information that compose the binormal
@@ -90,8 +229,88 @@ namespace MN {
 		void solve(const Circle& a, const Circle& b, const Transform& btoa, const std::vector<piDomain>& bDomain, std::vector<Binormal>& bins, bool refine = true, Real precision = 1e-10);
 		void solve(const CircularArc& a, const CircularArc& b, const Transform& btoa, const std::vector<piDomain>& bDomain, std::vector<Binormal>& bins, bool refine = true, Real precision = 1e-10);
 
+		// Reentrant versions of above functions : Every intermediate data is stored in [ ws ], which is owned by the caller
+		// If [ bins ] has enough capacity, no heap allocation occurs
+		static void solve(const Circle& a, const Circle& b, const Transform& tA, const Transform& tB, Workspace& ws, std::vector<Binormal>& bins, bool refine = true, Real precision = 1e-10);
+		static void solve(const CircularArc& a, const CircularArc& b, const Transform& tA, const Transform& tB, Workspace& ws, std::vector<Binormal>& bins, bool refine = true, Real precision = 1e-10);
+
+		static void solve(const Circle& a, const Circle& b, const Transform& btoa, Workspace& ws, std::vector<Binormal>& bins, bool refine = true, Real precision = 1e-10);
+		static void solve(const CircularArc& a, const CircularArc& b, const Transform& btoa, Workspace& ws, std::vector<Binormal>& bins, bool refine = true, Real precision = 1e-10);
+
+		static void solve(const Circle& a, const Circle& b, const Transform& btoa, const std::vector<piDomain>& bDomain, Workspace& ws, std::vector<Binormal>& bins, bool refine = true, Real precision = 1e-10);
+		static void solve(const CircularArc& a, const CircularArc& b, const Transform& btoa, const std::vector<piDomain>& bDomain, Workspace& ws, std::vector<Binormal>& bins, bool refine = true, Real precision = 1e-10);
+
+		// Find binormal with minimum distance between two circles ( or arcs ), instead of every binormal
+		// Since domains that cannot have shorter binormal than the current one are discarded, it is usually much faster than [ solve ]
+		// @bin :		Result binormal. If two circles share same axis and center, [ bin.type ] is 1 and only [ bin.distance ] is valid
+		// @bound :		Binormals that are not shorter than this value are ignored
+		// @return :	False if there is no binormal shorter than [ bound ]
+		bool solveMin(const Circle& a, const Circle& b, const Transform& tA, const Transform& tB, Binormal& bin, Real bound = maxDouble, Real precision = 1e-10);
+		bool solveMin(const CircularArc& a, const CircularArc& b, const Transform& tA, const Transform& tB, Binormal& bin, Real bound = maxDouble, Real precision = 1e-10);
+
+		bool solveMin(const Circle& a, const Circle& b, const Transform& btoa, Binormal& bin, Real bound = maxDouble, Real precision = 1e-10);
+		bool solveMin(const CircularArc& a, const CircularArc& b, const Transform& btoa, Binormal& bin, Real bound = maxDouble, Real precision = 1e-10);
+
+		// Reentrant versions of above functions
+		static bool solveMin(const Circle& a, const Circle& b, const Transform& tA, const Transform& tB, Workspace& ws, Binormal& bin, Real bound = maxDouble, Real precision = 1e-10);
+		static bool solveMin(const CircularArc& a, const CircularArc& b, const Transform& tA, const Transform& tB, Workspace& ws, Binormal& bin, Real bound = maxDouble, Real precision = 1e-10);
+
+		static bool solveMin(const Circle& a, const Circle& b, const Transform& btoa, Workspace& ws, Binormal& bin, Real bound = maxDouble, Real precision = 1e-10);
+		static bool solveMin(const CircularArc& a, const CircularArc& b, const Transform& btoa, Workspace& ws, Binormal& bin, Real bound = maxDouble, Real precision = 1e-10);
+
+		// Find binormal with maximum distance between two circles ( or arcs ), pruning domains that cannot have longer binormal than the current one
+		// @bin :		Result binormal. If two circles share same axis and center, [ bin.type ] is 1 and only [ bin.distance ] is valid
+		// @bound :		Binormals that are not longer than this value are ignored
+		// @return :	False if there is no binormal longer than [ bound ]
+		bool solveMax(const Circle& a, const Circle& b, const Transform& tA, const Transform& tB, Binormal& bin, Real bound = 0.0, Real precision = 1e-10);
+		bool solveMax(const CircularArc& a, const CircularArc& b, const Transform& tA, const Transform& tB, Binormal& bin, Real bound = 0.0, Real precision = 1e-10);
+
+		bool solveMax(const Circle& a, const Circle& b, const Transform& btoa, Binormal& bin, Real bound = 0.0, Real precision = 1e-10);
+		bool solveMax(const CircularArc& a, const CircularArc& b, const Transform& btoa, Binormal& bin, Real bound = 0.0, Real precision = 1e-10);
+
+		// Reentrant versions of above functions
+		static bool solveMax(const Circle& a, const Circle& b, const Transform& tA, const Transform& tB, Workspace& ws, Binormal& bin, Real bound = 0.0, Real precision = 1e-10);
+		static bool solveMax(const CircularArc& a, const CircularArc& b, const Transform& tA, const Transform& tB, Workspace& ws, Binormal& bin, Real bound = 0.0, Real precision = 1e-10);
+
+		static bool solveMax(const Circle& a, const Circle& b, const Transform& btoa, Workspace& ws, Binormal& bin, Real bound = 0.0, Real precision = 1e-10);
+		static bool solveMax(const CircularArc& a, const CircularArc& b, const Transform& btoa, Workspace& ws, Binormal& bin, Real bound = 0.0, Real precision = 1e-10);
+
+		// Find binormals between two arcs, starting from binormals in [ tracker ] ( previous frame ) and refining them under [ btoa ] by NR
+		// It falls back to full [ solve ] if NR fails, [ btoa ] jumps too far from the previous one, or number of binormals could change
+		// @tracker : Updated with binormals of this frame
+		void track(const CircularArc& a, const CircularArc& b, const Transform& tA, const Transform& tB, Tracker& tracker, std::vector<Binormal>& bins, Real precision = 1e-10);
+		void track(const CircularArc& a, const CircularArc& b, const Transform& btoa, Tracker& tracker, std::vector<Binormal>& bins, Real precision = 1e-10);
+
+		// Reentrant versions of above functions
+		static void track(const CircularArc& a, const CircularArc& b, const Transform& tA, const Transform& tB, Tracker& tracker, Workspace& ws, std::vector<Binormal>& bins, Real precision = 1e-10);
+		static void track(const CircularArc& a, const CircularArc& b, const Transform& btoa, Tracker& tracker, Workspace& ws, std::vector<Binormal>& bins, Real precision = 1e-10);
+
+		// Build normalized 8-th degree binormal polynomial of every pair in [ batch ] at once
+		// @coefs : [ 9 * batch.num ] coefficients, 9 consecutive values for each pair ( coefs[9 * i + j] for cos^j of i-th pair )
+		static void buildPolynomials(const PairBatch& batch, Real coefs[]);
+
+		// Find roots of [ num ] 8-th degree polynomials in [ domains ] at once
+		// Polynomials are assigned to [ BatchWorkspace::lanes ] lanes, whose Newton steps run in lockstep
+		// Domains are elevated to degree 8 and stored as structure of arrays, so that every lane runs the same branchless kernel
+		// When a lane finishes its polynomial, it is refilled with the next one
+		// At most [ maxRootNum ] roots are reported for each polynomial
+		// @coefs : [ 9 * num ] monomial coefficients, same layout as [ buildPolynomials ]
+		// @roots : [ maxRootNum * num ] roots, [ maxRootNum ] consecutive slots for each polynomial
+		// @rootNum : [ num ] number of roots found for each polynomial
+		static void solvePolynomials(int num, const Real coefs[], const Domain domains[], int domainNum, Real roots[], int rootNum[], BatchWorkspace& ws);
+
+		// Find binormals between every full circle pair in [ batch ]
+		// Polynomials are built by [ buildPolynomials ] and solved by [ solvePolynomials ] in batch
+		// Pairs in special configurations ( coaxial, or roots in closed form ) are classified first and solved as in scalar [ solve ]
+		// @bins : Array of [ batch.num ] result vectors
+		static void solve(const PairBatch& batch, BatchWorkspace& ws, std::vector<Binormal> bins[], bool refine = true, Real precision = 1e-10);
+
 		// Function to test validity of above functions
 		// Just sample points from [ b ] and find binormals
+		// Samples are processed in chunks, whose projection and NR refinement run in lockstep ( see Benchmark/CircleBinormalValidation.cpp for the harness )
+		// It runs on the calling thread and does not spawn threads per call, so callers parallelize over pairs, as the harness does
+		// NR starts only from samples where |fvec[1]| + |fvec[2]| < 1.0 ( [ BRUTE_NR_FILTER ] ). It was 0.2 on a sum that counted |fvec[1]| twice,
+		// which dropped real binormals after the sum was corrected
 		void bruteSolve(const CircularArc& a, const CircularArc& b, const Transform& tA, const Transform& tB, std::vector<Binormal>& bins, Real precision = 1e-10, int sampleNum = 1000);
 	};
 }
@@ -7,12 +7,24 @@
  */
 
 #include "CircleDistance.h"
+#include <algorithm>
+#include <chrono>
 
 #define ITMAX 100
 #define EPS 1.0e-10
 #define ZEPS 1.0e-10
 #define MOV3(a,b,c, d,e,f) (a)=(d);(b)=(e);(c)=(f);
 #define SIGN(a,b) ((b) >= 0.0 ? fabs(a) : -fabs(a))
+#define DISC_EPS 1.0e-6		// Negative discriminant of reduced quadratic in Vranek's algorithm is regarded as zero if its ratio to squared linear coefficient is smaller than this
+
+#define LANES			8			// Number of circle pairs processed in lockstep in batch
+#define SAMPLE_NUM		8			// Number of samples to find initial guess of local minimum in batch
+#define NEWTON_ITER		8			// Maximum number of Newton steps to find local minimum in batch, if it cannot be bracketed
+#define BRACKET_ITER	24			// Maximum number of safeguarded Newton steps to find root of derivative in a bracket in batch
+#define ROOT_Q_EPS		1e-20		// Lower bound of the term in square root of squared distance function, for stability
+
+#define LINE_NR_ITER	4			// Maximum number of Newton steps to polish minimum of line distance
+#define MAX_SEED_NUM	4			// Number of points on circle B whose farthest points give initial pair of maximum distance
 
 namespace MN {
 	struct Vranek {
@@ -45,13 +57,15 @@ namespace MN {
 		return -vv.a[9] * vv.sint + vv.a[8] * vv.cost + vv.a[6] * 0.5 * (1.0 / vv.root) * (2.0 * vv.costsint * (vv.a[4] - vv.a[5]) - vv.a[3] * vv.sint + vv.a[2] * vv.cost + vv.a[1] * (vv.cost2 - vv.sint2));
 	}
 
-	inline static Real vranekZbrent(Real x1, Real x2, Real tol, Vranek& vv) {
+	// Root of derivative in bracket [ x1, x2 ] is stored in [ root ]
+	// @return : False if the root is not bracketed or iteration limit is exceeded
+	inline static bool vranekZbrent(Real x1, Real x2, Real tol, Vranek& vv, Real& root) noexcept {
 		int iter;
 		Real a = x1, b = x2, c = x2, d, e, min1, min2;
 		Real(*func)(Real, Vranek&) = vranekDifferentiate;
 		Real fa = (func)(a, vv), fb = (func)(b, vv), fc, p, q, r, s, tol1, xm;
 		if ((fa > 0. && fb > 0.) || (fa < 0. && fb < 0.)) 
-			throw(std::runtime_error("Root must be bracketed in zbrent"));
+			return false;
 		fc = fb;
 		for (iter = 1; iter <= ITMAX; iter++) {
 			if ((fb > 0.0 && fc > 0.0) || (fb < 0.0 && fc < 0.0)) {
@@ -69,7 +83,10 @@ namespace MN {
 			}
 			tol1 = 2.0 * EPS * fabs(b) + 0.5 * tol;
 			xm = 0.5 * (c - b);
-			if (fabs(xm) <= tol1 || fb == 0.0) return b;
+			if (fabs(xm) <= tol1 || fb == 0.0) {
+				root = b;
+				return true;
+			}
 			if (fabs(e) >= tol1 && fabs(fa) > fabs(fb)) {
 				s = fb / fa;
 				if (a == c) {
@@ -107,9 +124,11 @@ namespace MN {
 				b += SIGN(tol1, xm);
 			fb = (*func)(b, vv);
 		}
-		throw(std::runtime_error("Maximum number of iterations exceeded in zbrent"));
+		return false;
 	}
-	inline static Real vranekDbrent(Real ax, Real bx, Real cx, Vranek& vv, Real tol, Real* xmin) {
+	// Local minimum in bracket [ ax, bx, cx ] is stored in [ fmin ], and its parameter in [ xmin ]
+	// @return : False if iteration limit is exceeded
+	inline static bool vranekDbrent(Real ax, Real bx, Real cx, Vranek& vv, Real tol, Real* xmin, Real* fmin) noexcept {
 		int iter, ok1, ok2;
 		Real a, b, d, d1, d2, du, dv, dw, dx, e = 0.0;
 		Real fu, fv, fw, fx, olde, tol1, tol2, u, u1, u2, v, w, x, xm;
@@ -127,7 +146,8 @@ namespace MN {
 			tol2 = 2.0 * tol1;
 			if (fabs(x - xm) <= (tol2 - 0.5 * (b - a))) {
 				*xmin = x;
-				return fx;
+				*fmin = fx;
+				return true;
 			}
 			if (fabs(e) > tol1) {
 				d1 = 2.0 * (b - a);
@@ -172,7 +192,8 @@ namespace MN {
 				fu = (*f)(u, vv);
 				if (fu > fx) {
 					*xmin = x;
-					return fx;
+					*fmin = fx;
+					return true;
 				}
 			}
 			du = (*df)(u, vv);
@@ -193,17 +214,25 @@ namespace MN {
 				}
 			}
 		}
-		throw(std::runtime_error("Too many iterations in Vranek Dbrent"));
+		return false;
 	}
 
-	inline static void cosclamp(Real& cosval) {
+	inline static void cosclamp(Real& cosval) noexcept {
 		if (cosval > 1 && cosval < 1 + 1e-5)
 			cosval = 1;
 		else if (cosval < -1 && cosval > -1 - 1e-5)
 			cosval = -1;
 	}
 
-	Distance circleDistance(const Circle& a, const Circle& b, const Transform& tA, const Transform& tB) {
+	// Workspace for binormal search, kept per thread so that it is not allocated for every pair
+	inline static CircleBinormal::Workspace& binormalWorkspace() {
+		static thread_local CircleBinormal::Workspace ws;
+		return ws;
+	}
+
+	// Vranek's algorithm without exceptions, result is stored in [ distance ]
+	// @return : [ Success ], or the reason of failure ( [ BracketFailure ] or [ IterationFailure ] )
+	static CircleDistanceStatus vranekDistance(const Circle& a, const Circle& b, const Transform& tA, const Transform& tB, Distance& distance) noexcept {
 		// @cen_a, cen_b	: center of circle [ca], [cb].
 		// @norm_a, norm_b	: axis of circle [ca], [cb].
 		// @U, V			: local X, Y axis of [cb].
@@ -261,7 +290,7 @@ namespace MN {
 					c = tmp + PI20;
 				}
 				else if (fb == fc) 
-					throw(std::runtime_error("Vranek error"));
+					return CircleDistanceStatus::BracketFailure;
 			}
 			else if (fb > fa) {
 				if (fb > fc) {
@@ -280,7 +309,7 @@ namespace MN {
 						b = tmp;
 					}
 					else 
-						throw(std::runtime_error("Vranek error"));
+						return CircleDistanceStatus::BracketFailure;
 				}
 				else if (fb < fc) {
 					Real
@@ -290,12 +319,13 @@ namespace MN {
 					b = tmp;
 				}
 				else 
-					throw(std::runtime_error("Vranek error"));
+					return CircleDistanceStatus::BracketFailure;
 			}
 			else 
-				throw(std::runtime_error("Vranek error"));
+				return CircleDistanceStatus::BracketFailure;
 
-			loc_min = vranekDbrent(a, b, c, vv, 1e-10, &loc_min_t);
+			if (!vranekDbrent(a, b, c, vv, 1e-10, &loc_min_t, &loc_min))
+				return CircleDistanceStatus::IterationFailure;
 			if (loc_min <0 && loc_min > -1e-10)
 				loc_min = 0;
 		}
@@ -353,6 +383,9 @@ namespace MN {
 				gl_min_t = loc_min_t;
 			}*/
 			// 4-2. global minimum has to be found.
+			// Slightly negative discriminant comes from rounding, when two points of the level set have close cosines ( around 0 or PI )
+			if (b_4ac < 0.0 && b_4ac > -DISC_EPS * eq[1] * eq[1])
+				b_4ac = 0.0;
 			if (b_4ac >= 0.0)
 			{
 				Real
@@ -379,62 +412,853 @@ namespace MN {
 					if (denom * nom < 0)
 						b = pi20 - b;
 				}*/
-				{
-					Real a = acos(cosa), b = acos(cosb);
-					if (vranekDifferentiate(a, vv) * vranekDifferentiate(b, vv) < 0.0)
-					{
-						loc_min_t = vranekZbrent(a, b, 1e-10, vv);
-						loc_min = vranekEvaluate(loc_min_t, vv);
-						if (loc_min < gl_min) {
-							gl_min = loc_min;
-							gl_min_t = loc_min_t;
-						}
-					}
-				}
-				{
-					Real a = acos(cosa), b = PI20 - acos(cosb);
-					if (vranekDifferentiate(a, vv) * vranekDifferentiate(b, vv) < 0.0)
-					{
-						loc_min_t = vranekZbrent(a, b, 1e-10, vv);
-						loc_min = vranekEvaluate(loc_min_t, vv);
-						if (loc_min < gl_min) {
-							gl_min = loc_min;
-							gl_min_t = loc_min_t;
-						}
-					}
-				}
-				{
-					Real a = PI20 - acos(cosa), b = acos(cosb);
-					if (vranekDifferentiate(a, vv) * vranekDifferentiate(b, vv) < 0.0)
-					{
-						loc_min_t = vranekZbrent(a, b, 1e-10, vv);
-						loc_min = vranekEvaluate(loc_min_t, vv);
-						if (loc_min < gl_min) {
-							gl_min = loc_min;
-							gl_min_t = loc_min_t;
-						}
-					}
-				}
-				{
-					Real a = PI20 - acos(cosa), b = PI20 - acos(cosb);
-					if (vranekDifferentiate(a, vv) * vranekDifferentiate(b, vv) < 0.0)
+				// Global minimum has cosine [ cosa ] or [ cosb ], so search between neighbouring candidates around the circle
+				// Candidates are sorted, so that the interval across 0 is also searched
+				if (!(fabs(cosa) <= 1))
+					cosa = cosb;
+				if (!(fabs(cosb) <= 1))
+					cosb = cosa;
+				Real
+					ea = acos(cosa),
+					eb = acos(cosb),
+					e0 = std::min(ea, eb),
+					e1 = std::max(ea, eb),
+					ends[5] = { e0, e1, PI20 - e1, PI20 - e0, PI20 + e0 };
+				// Since [ a ] < [ b ], only brackets where derivative goes from negative to positive contain minimum
+				for (int i = 0; i < 4; i++) {
+					Real a = ends[i], b = ends[i + 1];
+					if (vranekDifferentiate(a, vv) < 0.0 && vranekDifferentiate(b, vv) > 0.0)
 					{
-						loc_min_t = vranekZbrent(a, b, 1e-10, vv);
+						if (!vranekZbrent(a, b, 1e-10, vv, loc_min_t))
+							return CircleDistanceStatus::IterationFailure;
 						loc_min = vranekEvaluate(loc_min_t, vv);
 						if (loc_min < gl_min) {
 							gl_min = loc_min;
-							gl_min_t = loc_min_t;
+							gl_min_t = (loc_min_t >= PI20) ? loc_min_t - PI20 : loc_min_t;
 						}
 					}
 				}
 			}
-			Distance distance;
 			distance.length = sqrt(gl_min);
 			distance.paramB[0] = gl_min_t;
 			distance.pointB = b.evaluate(gl_min_t);
 			a.findMinDistParam(btoa.apply(distance.pointB), distance.paramA[0]);
 			distance.pointA = a.evaluate(distance.paramA[0]);
+			return CircleDistanceStatus::Success;
+		}
+	}
+
+	Distance distance(const Circle& a, const Circle& b, const Transform& tA, const Transform& tB) {
+		Distance distance;
+		CircleDistanceStatus status = vranekDistance(a, b, tA, tB, distance);
+		if (status == CircleDistanceStatus::BracketFailure)
+			throw(std::runtime_error("Vranek error"));
+		else if (status == CircleDistanceStatus::IterationFailure)
+			throw(std::runtime_error("Too many iterations in Vranek"));
+		return distance;
+	}
+
+	// Minimum distance between two circles by the shortest binormal, result is stored in [ distance ]
+	// It is slower than Vranek's algorithm, but also handles coaxial circles
+	// @return : False if binormal could not be found
+	static bool binormalDistance(const Circle& a, const Circle& b, const Transform& tA, const Transform& tB, Distance& distance) noexcept {
+		// Exceptions are rare enough to afford exception handling here
+		CircleBinormal::Binormal bin;
+		try {
+			if (!CircleBinormal::solveMin(a, b, tA, tB, binormalWorkspace(), bin))
+				return false;
+		}
+		catch (...) {
+			return false;
+		}
+		distance.length = bin.distance;
+		if (bin.type == 1) {
+			// Coaxial : Every point on [ b ] is closest to [ a ], so pick parameter 0
+			Transform btoa = Transform::connect(tB, tA);
+			distance.paramB[0] = 0.0;
+			distance.pointB = b.evaluate(0.0);
+			a.findMinDistParam(btoa.apply(distance.pointB), distance.paramA[0]);
+			distance.pointA = a.evaluate(distance.paramA[0]);
+		}
+		else {
+			distance.paramA[0] = bin.paramA;
+			distance.paramB[0] = bin.paramB;
+			distance.pointA = bin.pointA;
+			distance.pointB = bin.pointB;
+		}
+		return true;
+	}
+
+	CircleDistanceStatus distance(const Circle& a, const Circle& b, const Transform& tA, const Transform& tB, Distance& distance) noexcept {
+		CircleDistanceStatus status = vranekDistance(a, b, tA, tB, distance);
+		if (status == CircleDistanceStatus::Success)
+			return status;
+
+		// Fall back to the shortest binormal
+		if (!binormalDistance(a, b, tA, tB, distance))
+			return CircleDistanceStatus::Failure;
+		return status;
+	}
+
+	// Arc
+	// Bounding sphere of arc [ a ] in its local coordinates
+	// If the arc spans less than a half circle, the sphere around its chord is smaller than the one around the full circle
+	inline static void arcSphere(const CircularArc& a, Vec3& center, Real& radius) {
+		Real width = a.domain.width();
+		if (width > PI) {
+			center = { 0.0, 0.0, 0.0 };
+			radius = a.radius;
+			return;
+		}
+		Real mid = a.domain.middle(), halfCos = cos(width * 0.5);
+		center = { a.radius * halfCos * cos(mid), a.radius * halfCos * sin(mid), 0.0 };
+		radius = a.radius * sin(width * 0.5);
+	}
+	// Closest point on arc [ a ] to the point [ pt ] ( in local coordinates of [ a ] ), given as a candidate of minimum distance
+	// @ptParam, ptPoint : Parameter and local point on the other arc that [ pt ] comes from
+	// @swap : If true, [ a ] is arc B of [ distance ]
+	inline static void arcEndCandidate(const CircularArc& a, const Vec3& pt, Real ptParam, const Vec3& ptPoint, bool swap, Distance& distance) {
+		Real param;
+		a.findMinDistParam(pt, param);
+		Vec3 apt = a.evaluate(param);
+		Real length = apt.dist(pt);
+		if (length >= distance.length)
+			return;
+		distance.length = length;
+		if (swap) {
+			distance.paramA[0] = ptParam;
+			distance.pointA = ptPoint;
+			distance.paramB[0] = param;
+			distance.pointB = apt;
+		}
+		else {
+			distance.paramA[0] = param;
+			distance.pointA = apt;
+			distance.paramB[0] = ptParam;
+			distance.pointB = ptPoint;
+		}
+	}
+
+	Distance distance(const CircularArc& a, const CircularArc& b, const Transform& tA, const Transform& tB) {
+		Transform
+			btoa = Transform::connect(tB, tA),
+			atob = Transform::connect(tA, tB);
+		Distance distance;
+		distance.length = maxDouble;
+
+		// 1. Minimum distance from end points of each arc to the other arc
+		// If minimum distance is not found at a binormal, it is one of these
+		{
+			Real params[2] = { a.domain.beg(), a.domain.end() };
+			for (int i = 0; i < 2; i++) {
+				Vec3 pt = a.evaluate(params[i]);
+				arcEndCandidate(b, atob.apply(pt), params[i], pt, true, distance);
+			}
+		}
+		{
+			Real params[2] = { b.domain.beg(), b.domain.end() };
+			for (int i = 0; i < 2; i++) {
+				Vec3 pt = b.evaluate(params[i]);
+				arcEndCandidate(a, btoa.apply(pt), params[i], pt, false, distance);
+			}
+		}
+
+		// 2. If bounding spheres of two arcs are not closer than end point distance, it is the answer
+		{
+			Vec3 centerA, centerB;
+			Real radiusA, radiusB;
+			arcSphere(a, centerA, radiusA);
+			arcSphere(b, centerB, radiusB);
+			if (centerA.dist(btoa.apply(centerB)) - radiusA - radiusB >= distance.length)
+				return distance;
+		}
+
+		// 3. Search binormal that is shorter than end point distance
+		CircleBinormal::Binormal bin;
+		if (!CircleBinormal::solveMin(a, b, btoa, binormalWorkspace(), bin, distance.length))
+			return distance;
+		if (bin.type == 1) {
+			// Coaxial : Every pair of points in the same direction is closest, so find such pair in both domains
+			// If there is none, minimum distance is at end points
+			Real param;
+			Vec3 pt = b.evaluate(b.domain.beg());
+			a.Circle::findMinDistParam(btoa.apply(pt), param);
+			if (a.domain.has(param)) {
+				distance.length = bin.distance;
+				distance.paramA[0] = param;
+				distance.pointA = a.evaluate(param);
+				distance.paramB[0] = b.domain.beg();
+				distance.pointB = pt;
+				return distance;
+			}
+			pt = a.evaluate(a.domain.beg());
+			b.Circle::findMinDistParam(atob.apply(pt), param);
+			if (b.domain.has(param)) {
+				distance.length = bin.distance;
+				distance.paramA[0] = a.domain.beg();
+				distance.pointA = pt;
+				distance.paramB[0] = param;
+				distance.pointB = b.evaluate(param);
+			}
+			return distance;
+		}
+		distance.length = bin.distance;
+		distance.paramA[0] = bin.paramA;
+		distance.pointA = bin.pointA;
+		distance.paramB[0] = bin.paramB;
+		distance.pointB = bin.pointB;
+		return distance;
+	}
+
+	// Max distance
+	// Farthest point on arc [ a ] from the point [ pt ] ( in local coordinates of [ a ] ), given as a candidate of maximum distance
+	// @ptParam, ptPoint : Parameter and local point on the other arc that [ pt ] comes from
+	// @swap : If true, [ a ] is arc B of [ distance ]
+	inline static void arcFarEndCandidate(const CircularArc& a, const Vec3& pt, Real ptParam, const Vec3& ptPoint, bool swap, Distance& distance) {
+		Real param;
+		a.findMaxDistParam(pt, param);
+		Vec3 apt = a.evaluate(param);
+		Real length = apt.dist(pt);
+		if (length <= distance.length)
+			return;
+		distance.length = length;
+		if (swap) {
+			distance.paramA[0] = ptParam;
+			distance.pointA = ptPoint;
+			distance.paramB[0] = param;
+			distance.pointB = apt;
+		}
+		else {
+			distance.paramA[0] = param;
+			distance.pointA = apt;
+			distance.paramB[0] = ptParam;
+			distance.pointB = ptPoint;
+		}
+	}
+	Distance maxDistance(const Circle& a, const Circle& b, const Transform& tA, const Transform& tB) {
+		Transform btoa = Transform::connect(tB, tA);
+		CircularArc arcA;
+		arcA.radius = a.radius;
+		arcA.domain = piDomain::create(0, PI20);
+		Distance distance;
+		distance.length = 0.0;
+
+		// 1. Farthest points from a few points on [ b ] give initial pair, which prunes binormals that are not longer
+		for (int i = 0; i < MAX_SEED_NUM; i++) {
+			Real param = PI20 * i / MAX_SEED_NUM;
+			Vec3 pt = b.evaluate(param);
+			arcFarEndCandidate(arcA, btoa.apply(pt), param, pt, false, distance);
+		}
+
+		// 2. Search binormal that is longer than initial pair
+		// If there is none ( e.g. coaxial circles, where every pair in the opposite directions is farthest ), initial pair is the answer
+		CircleBinormal::Binormal bin;
+		if (!CircleBinormal::solveMax(a, b, btoa, binormalWorkspace(), bin, distance.length) || bin.type == 1)
+			return distance;
+		distance.length = bin.distance;
+		distance.paramA[0] = bin.paramA;
+		distance.paramB[0] = bin.paramB;
+		distance.pointA = bin.pointA;
+		distance.pointB = bin.pointB;
+		return distance;
+	}
+	Distance maxDistance(const CircularArc& a, const CircularArc& b, const Transform& tA, const Transform& tB) {
+		Transform
+			btoa = Transform::connect(tB, tA),
+			atob = Transform::connect(tA, tB);
+		Distance distance;
+		distance.length = 0.0;
+
+		// 1. Maximum distance from end points of each arc to the other arc
+		// If maximum distance is not found at a binormal, it is one of these
+		{
+			Real params[2] = { a.domain.beg(), a.domain.end() };
+			for (int i = 0; i < 2; i++) {
+				Vec3 pt = a.evaluate(params[i]);
+				arcFarEndCandidate(b, atob.apply(pt), params[i], pt, true, distance);
+			}
+		}
+		{
+			Real params[2] = { b.domain.beg(), b.domain.end() };
+			for (int i = 0; i < 2; i++) {
+				Vec3 pt = b.evaluate(params[i]);
+				arcFarEndCandidate(a, btoa.apply(pt), params[i], pt, false, distance);
+			}
+		}
+
+		// 2. If bounding spheres of two arcs are not farther than end point distance, it is the answer
+		{
+			Vec3 centerA, centerB;
+			Real radiusA, radiusB;
+			arcSphere(a, centerA, radiusA);
+			arcSphere(b, centerB, radiusB);
+			if (centerA.dist(btoa.apply(centerB)) + radiusA + radiusB <= distance.length)
+				return distance;
+		}
+
+		// 3. Search binormal that is longer than end point distance
+		CircleBinormal::Binormal bin;
+		if (!CircleBinormal::solveMax(a, b, btoa, binormalWorkspace(), bin, distance.length))
 			return distance;
+		if (bin.type == 1) {
+			// Coaxial : Every pair of points in the opposite directions is farthest, so find such pair in both domains
+			// If there is none, maximum distance is at end points
+			Real param;
+			Vec3 pt = b.evaluate(b.domain.beg());
+			a.Circle::findMaxDistParam(btoa.apply(pt), param);
+			if (a.domain.has(param)) {
+				distance.length = bin.distance;
+				distance.paramA[0] = param;
+				distance.pointA = a.evaluate(param);
+				distance.paramB[0] = b.domain.beg();
+				distance.pointB = pt;
+				return distance;
+			}
+			pt = a.evaluate(a.domain.beg());
+			b.Circle::findMaxDistParam(atob.apply(pt), param);
+			if (b.domain.has(param)) {
+				distance.length = bin.distance;
+				distance.paramA[0] = a.domain.beg();
+				distance.pointA = pt;
+				distance.paramB[0] = param;
+				distance.pointB = b.evaluate(param);
+			}
+			return distance;
+		}
+		distance.length = bin.distance;
+		distance.paramA[0] = bin.paramA;
+		distance.pointA = bin.pointA;
+		distance.paramB[0] = bin.paramB;
+		distance.pointB = bin.pointB;
+		return distance;
+	}
+
+	// Line
+	// Critical points of squared distance between circle of radius [ r ] and the line through [ p ] along unit vector [ d ], as ( cosine, sine ) of parameter
+	// @num : At most [ lineCriticalMaxNum ]
+	static void lineCriticalPoints(Real r, const Vec3& p, const Vec3& d, Real cosu[], Real sinu[], int& num) {
+		// Squared distance between circle point [ r * ( c, s, 0 ) ] and the line is
+		// f(t) = const - 2r * ( wx * c + wy * s ) - r^2 * ( dx * c + dy * s )^2, where [ w ] is component of [ p ] perpendicular to [ d ]
+		// f'(t) = 0 is s * ( wx - alpha * c ) = wy * c + beta * ( 2c^2 - 1 ), and squaring it gives quartic in [ c ]
+		const Real
+			pd = p.dot(d),
+			wx = p[0] - pd * d[0],
+			wy = p[1] - pd * d[1],
+			alpha = r * (SQ(d[1]) - SQ(d[0])),
+			beta = r * d[0] * d[1];
+		Real coef[5] = {
+			SQ(wx) - SQ(beta),
+			2.0 * (beta * wy - alpha * wx),
+			SQ(alpha) - SQ(wx) - SQ(wy) + 4.0 * SQ(beta),
+			2.0 * (alpha * wx - 2.0 * beta * wy),
+			-SQ(alpha) - 4.0 * SQ(beta)
+		};
+
+		// Roots of squared equation include those with wrong sign of [ s ], so both signs are given
+		Real roots[Polynomial::maxCandidateNum + 2];
+		int rootNum;
+		Polynomial::rootCandidates(coef, 4, -1.0, 1.0, roots, rootNum);
+		roots[rootNum++] = -1.0;
+		roots[rootNum++] = 1.0;
+		num = 0;
+		for (int i = 0; i < rootNum; i++) {
+			Real s = sqrt(std::max(0.0, 1.0 - SQ(roots[i])));
+			cosu[num] = roots[i];
+			sinu[num++] = s;
+			if (s > 0.0) {
+				cosu[num] = roots[i];
+				sinu[num++] = -s;
+			}
+		}
+	}
+	void lineCriticalParams(const Circle& circle, const Line& line, Real params[], int& paramNum) {
+		Vec3 d = line.direction;
+		d.normalize();
+		Real cosu[lineCriticalMaxNum], sinu[lineCriticalMaxNum];
+		lineCriticalPoints(circle.radius, line.point, d, cosu, sinu, paramNum);
+		for (int i = 0; i < paramNum; i++)
+			params[i] = piDomain::regularize(atan2(sinu[i], cosu[i]));
+	}
+	// Candidate of minimum distance between circle point [ r * ( c, s, 0 ) ] and its closest point on the line [ p + l * d ] with l in [ lBeg, lEnd ]
+	// @t : Parameter of the circle point, or negative to compute it only if the candidate is taken
+	inline static void lineCandidate(Real r, Real c, Real s, Real t, const Vec3& p, const Vec3& d, Real lBeg, Real lEnd, Distance& distance) {
+		Vec3 apt{ r * c, r * s, 0.0 };
+		Real l = (apt - p).dot(d);
+		if (l < lBeg || l > lEnd)
+			return;
+		Vec3 bpt = p + d * l;
+		Real length = apt.dist(bpt);
+		if (length >= distance.length)
+			return;
+		distance.length = length;
+		distance.paramA[0] = (t < 0.0) ? piDomain::regularize(atan2(s, c)) : t;
+		distance.pointA = apt;
+		distance.paramB[0] = l;
+		distance.pointB = bpt;
+	}
+	// Minimum distance between [ arc ] and the line [ p + l * d ] with l in [ lBeg, lEnd ], where [ d ] is unit vector
+	// @full : If true, [ arc ] is regarded as full circle
+	static void lineDistance(const CircularArc& arc, bool full, const Vec3& p, const Vec3& d, Real lBeg, Real lEnd, Distance& distance) {
+		const Real r = arc.radius;
+
+		// 1. Critical points of squared distance
+		{
+			Real cosu[lineCriticalMaxNum], sinu[lineCriticalMaxNum];
+			int num;
+			lineCriticalPoints(r, p, d, cosu, sinu, num);
+			for (int i = 0; i < num; i++) {
+				if (full)
+					lineCandidate(r, cosu[i], sinu[i], -1.0, p, d, lBeg, lEnd, distance);
+				else {
+					Real t = piDomain::regularize(atan2(sinu[i], cosu[i]));
+					if (arc.domain.has(t))
+						lineCandidate(r, cosu[i], sinu[i], t, p, d, lBeg, lEnd, distance);
+				}
+			}
+		}
+
+		// 2. End points
+		if (!full) {
+			Real params[2] = { arc.domain.beg(), arc.domain.end() };
+			for (int i = 0; i < 2; i++) {
+				Vec3 apt = arc.evaluate(params[i]);
+				Real l = std::min(std::max((apt - p).dot(d), lBeg), lEnd);
+				Vec3 bpt = p + d * l;
+				Real length = apt.dist(bpt);
+				if (length < distance.length) {
+					distance.length = length;
+					distance.paramA[0] = params[i];
+					distance.pointA = apt;
+					distance.paramB[0] = l;
+					distance.pointB = bpt;
+				}
+			}
+		}
+		if (lBeg > -maxDouble && lEnd < maxDouble) {
+			Real params[2] = { lBeg, lEnd };
+			for (int i = 0; i < 2; i++) {
+				Vec3 bpt = p + d * params[i];
+				Real t;
+				if (full) arc.Circle::findMinDistParam(bpt, t);
+				else arc.CircularArc::findMinDistParam(bpt, t);
+				Vec3 apt = arc.evaluate(t);
+				Real length = apt.dist(bpt);
+				if (length < distance.length) {
+					distance.length = length;
+					distance.paramA[0] = t;
+					distance.pointA = apt;
+					distance.paramB[0] = params[i];
+					distance.pointB = bpt;
+				}
+			}
+		}
+
+		// 3. Parameters from quartic lose precision where [ c ] is near -1 or 1, so polish the minimum with Newton steps on f'(t)
+		const Real
+			pd = p.dot(d),
+			wx = p[0] - pd * d[0],
+			wy = p[1] - pd * d[1];
+		for (int i = 0; i < LINE_NR_ITER; i++) {
+			Real
+				t = distance.paramA[0],
+				c = distance.pointA[0] / r,
+				s = distance.pointA[1] / r,
+				g = d[0] * c + d[1] * s,
+				dg = d[1] * c - d[0] * s,
+				df = 2.0 * r * (wx * s - wy * c) - 2.0 * SQ(r) * g * dg,
+				ddf = 2.0 * r * (wx * c + wy * s) - 2.0 * SQ(r) * (SQ(dg) - SQ(g));
+			if (ddf <= 0.0)
+				break;
+			Real nt = piDomain::regularize(t - df / ddf), length = distance.length;
+			if (!full && !arc.domain.has(nt))
+				break;
+			lineCandidate(r, cos(nt), sin(nt), nt, p, d, lBeg, lEnd, distance);
+			if (distance.length >= length)
+				break;
+		}
+	}
+	// Wrap [ circle ] as full arc, and convert line parameters of [ distance ] to [ 0, 1 ] ( segment ) or multiple of direction ( line )
+	inline static CircularArc fullArc(const Circle& circle) {
+		CircularArc arc;
+		arc.radius = circle.radius;
+		arc.domain = piDomain::create(0, PI20);
+		return arc;
+	}
+	static Distance lineDistance(const CircularArc& arc, bool full, const Line& line) {
+		Distance distance;
+		distance.length = maxDouble;
+		Real len = line.direction.len();
+		lineDistance(arc, full, line.point, line.direction / len, -maxDouble, maxDouble, distance);
+		distance.paramB[0] /= len;
+		return distance;
+	}
+	static Distance segmentDistance(const CircularArc& arc, bool full, const Segment& segment) {
+		Distance distance;
+		distance.length = maxDouble;
+		Vec3 d = segment.end - segment.beg;
+		Real len = d.len();
+		if (len == 0.0) {
+			// Degenerate segment is a point
+			Real t;
+			if (full) arc.Circle::findMinDistParam(segment.beg, t);
+			else arc.CircularArc::findMinDistParam(segment.beg, t);
+			distance.pointA = arc.evaluate(t);
+			distance.pointB = segment.beg;
+			distance.length = distance.pointA.dist(segment.beg);
+			distance.paramA[0] = t;
+			distance.paramB[0] = 0.0;
+			return distance;
+		}
+		lineDistance(arc, full, segment.beg, d / len, 0.0, len, distance);
+		distance.paramB[0] /= len;
+		return distance;
+	}
+	Distance distance(const Circle& circle, const Line& line) {
+		return lineDistance(fullArc(circle), true, line);
+	}
+	Distance distance(const CircularArc& arc, const Line& line) {
+		return lineDistance(arc, false, line);
+	}
+	Distance distance(const Circle& circle, const Segment& segment) {
+		return segmentDistance(fullArc(circle), true, segment);
+	}
+	Distance distance(const CircularArc& arc, const Segment& segment) {
+		return segmentDistance(arc, false, segment);
+	}
+
+	// Batch
+	// Every step runs for all lanes with fixed number of iterations, and lanes that are done ( or invalid ) just keep their values
+	// Sine and cosine without branches or library calls, so that loops over lanes can be vectorized
+	// [ t ] is reduced to [ -PI / 4, PI / 4 ] ( Cody-Waite ), and polynomials of fdlibm kernels are used there
+	// [ nearbyint ] is used for rounding, since unlike [ floor ] it does not raise inexact exception and is vectorized without -fno-trapping-math
+	inline static void vranekSinCos(Real t, Real& s, Real& c) {
+		const Real
+			pio2Hi = 1.57079632673412561417e+00,
+			pio2Lo = 6.07710050650619224932e-11;
+		Real q = nearbyint(t * (2.0 / PI));
+		Real r = (t - q * pio2Hi) - q * pio2Lo;
+		Real z = r * r;
+		Real ps = r + r * z * (-1.66666666666666324348e-01 + z * (8.33333333332248946124e-03 + z * (-1.98412698298579493134e-04 +
+			z * (2.75573137070700676789e-06 + z * (-2.50507602534068634195e-08 + z * 1.58969099521155010221e-10)))));
+		Real pc = 1.0 - 0.5 * z + z * z * (4.16666666666666019037e-02 + z * (-1.38888888888741095749e-03 + z * (2.48015872894767294178e-05 +
+			z * (-2.75573143513906633035e-07 + z * (2.08757232129817482790e-09 + z * -1.13596475577881948265e-11)))));
+		Real k = q - 4.0 * nearbyint(q * 0.25 - 0.375);		// Quadrant in { 0, 1, 2, 3 }, kept in floating point to stay in the same vector lanes
+		bool swap = (k == 1.0) | (k == 3.0);
+		Real ss = swap ? pc : ps;
+		Real cc = swap ? ps : pc;
+		s = (k >= 2.0) ? -ss : ss;
+		c = ((k == 1.0) | (k == 2.0)) ? -cc : cc;
+	}
+	// Squared distance function f(t) and its first, second derivative for every lane
+	inline static void vranekEvaluateBatch(const Real a[10][LANES], const Real t[LANES], Real f[LANES], Real df[LANES], Real ddf[LANES]) {
+		for (int l = 0; l < LANES; l++) {
+			Real c, s;
+			vranekSinCos(t[l], s, c);
+			Real
+				c2 = c * c,
+				s2 = s * s,
+				cs = c * s;
+			Real
+				q = a[5][l] * c2 + a[4][l] * s2 + a[3][l] * c + a[2][l] * s + a[1][l] * cs + a[0][l],
+				dq = 2.0 * cs * (a[4][l] - a[5][l]) - a[3][l] * s + a[2][l] * c + a[1][l] * (c2 - s2),
+				ddq = 2.0 * (c2 - s2) * (a[4][l] - a[5][l]) - a[3][l] * c - a[2][l] * s - 4.0 * a[1][l] * cs;
+			q = std::max(q, (Real)ROOT_Q_EPS);
+			Real
+				root = sqrt(q),
+				iroot = 1.0 / root;
+			f[l] = a[9][l] * c + a[8][l] * s + a[7][l] + a[6][l] * root;
+			df[l] = -a[9][l] * s + a[8][l] * c + a[6][l] * 0.5 * iroot * dq;
+			ddf[l] = -a[9][l] * c - a[8][l] * s + a[6][l] * (0.5 * iroot * ddq - 0.25 * iroot * iroot * iroot * dq * dq);
+		}
+	}
+	// Find root of derivative in bracket [ lo, hi ] for every lane ( [ dlo ] is derivative at [ lo ], and has different sign at [ hi ] )
+	// Newton step is taken if it stays in the bracket, or bisection otherwise
+	// Iteration stops when every lane in [ mask ] converged, or after [ BRACKET_ITER ] steps
+	inline static void vranekBracketBatch(const Real a[10][LANES], const bool mask[LANES], Real lo[LANES], Real hi[LANES], const Real dlo[LANES], Real t[LANES]) {
+		Real f[LANES], df[LANES], ddf[LANES];
+		for (int l = 0; l < LANES; l++)
+			t[l] = 0.5 * (lo[l] + hi[l]);
+		for (int i = 0; i < BRACKET_ITER; i++) {
+			vranekEvaluateBatch(a, t, f, df, ddf);
+			bool converged = true;
+			for (int l = 0; l < LANES; l++) {
+				bool sameLo = (df[l] * dlo[l] > 0);
+				lo[l] = sameLo ? t[l] : lo[l];
+				hi[l] = sameLo ? hi[l] : t[l];
+				Real nt = t[l] - df[l] / ddf[l];
+				bool inside = ((nt - lo[l]) * (nt - hi[l]) <= 0);
+				nt = inside ? nt : 0.5 * (lo[l] + hi[l]);
+				converged &= (!mask[l] || fabs(nt - t[l]) < 1e-10);
+				t[l] = nt;
+			}
+			if (converged)
+				break;
+		}
+	}
+
+	void distance(const CircleBinormal::PairBatch& batch, Distance distances[]) {
+		Real a[10][LANES];
+		Real t[LANES], f[LANES], df[LANES], ddf[LANES];
+		Real locMin[LANES], locMinT[LANES], glMin[LANES], glMinT[LANES], cosRoot[2][LANES];
+		bool valid[LANES];
+		int pair[LANES];
+
+		for (int beg = 0; beg < batch.num; beg += LANES) {
+			// Idle lanes repeat the last pair
+			for (int l = 0; l < LANES; l++)
+				pair[l] = std::min(beg + l, batch.num - 1);
+
+			// 0. Coefficients : Circle A is on XY plane of its local coordinates, so [ cen_a ] is zero and [ norm_a ] is Z axis
+			for (int l = 0; l < LANES; l++) {
+				int i = pair[l];
+				Real
+					ra = batch.radiusA[i],
+					rb = batch.radiusB[i],
+					C[3] = { batch.center[0][i], batch.center[1][i], batch.center[2][i] },
+					U[3] = { batch.axisU[0][i], batch.axisU[1][i], batch.axisU[2][i] },
+					V[3] = { batch.axisV[0][i], batch.axisV[1][i], batch.axisV[2][i] };
+				Real
+					cc = C[0] * C[0] + C[1] * C[1] + C[2] * C[2],
+					cu = C[0] * U[0] + C[1] * U[1] + C[2] * U[2],
+					cv = C[0] * V[0] + C[1] * V[1] + C[2] * V[2];
+				a[0][l] = rb * rb + cc - C[2] * C[2];
+				a[1][l] = -2.0 * rb * rb * U[2] * V[2];
+				a[2][l] = 2.0 * rb * cv - 2.0 * rb * C[2] * V[2];
+				a[3][l] = 2.0 * rb * cu - 2.0 * rb * C[2] * U[2];
+				a[4][l] = -SQ(rb * V[2]);
+				a[5][l] = -SQ(rb * U[2]);
+				a[6][l] = -2.0 * ra;
+				a[7][l] = ra * ra + rb * rb + cc;
+				a[8][l] = 2.0 * rb * cv;
+				a[9][l] = 2.0 * rb * cu;
+			}
+
+			// 1. Find single local minimum : Bracket it next to the smallest sample, and find root of derivative there
+			Real sampleDf[LANES], lo[LANES], hi[LANES], dhi[LANES];
+			bool mask[LANES], anyFail = false;
+			for (int l = 0; l < LANES; l++)
+				glMin[l] = maxDouble;
+			for (int k = 0; k < SAMPLE_NUM; k++) {
+				for (int l = 0; l < LANES; l++)
+					t[l] = PI20 * k / SAMPLE_NUM;
+				vranekEvaluateBatch(a, t, f, df, ddf);
+				for (int l = 0; l < LANES; l++) {
+					bool smaller = (f[l] < glMin[l]);
+					glMin[l] = smaller ? f[l] : glMin[l];
+					glMinT[l] = smaller ? t[l] : glMinT[l];
+					sampleDf[l] = smaller ? df[l] : sampleDf[l];
+				}
+			}
+			for (int l = 0; l < LANES; l++) {
+				lo[l] = glMinT[l];
+				hi[l] = glMinT[l] + ((sampleDf[l] < 0) ? PI20 : -PI20) / SAMPLE_NUM;
+			}
+			vranekEvaluateBatch(a, hi, f, dhi, ddf);
+			for (int l = 0; l < LANES; l++) {
+				mask[l] = (sampleDf[l] * dhi[l] < 0);
+				anyFail |= !mask[l];
+			}
+			vranekBracketBatch(a, mask, lo, hi, sampleDf, t);
+			if (anyFail) {
+				// Derivative does not change its sign in the bracket ( RARE ) : Take Newton steps that are bounded by sample interval
+				for (int l = 0; l < LANES; l++)
+					t[l] = mask[l] ? t[l] : glMinT[l];
+				for (int i = 0; i < NEWTON_ITER; i++) {
+					vranekEvaluateBatch(a, t, f, df, ddf);
+					bool converged = true;
+					for (int l = 0; l < LANES; l++) {
+						const Real maxStep = PI / SAMPLE_NUM;
+						Real step = (ddf[l] > 0) ? -df[l] / ddf[l] : ((df[l] > 0) ? -maxStep : maxStep);
+						step = mask[l] ? 0 : std::max(-maxStep, std::min(maxStep, step));
+						converged &= (fabs(step) < 1e-10);
+						t[l] += step;
+					}
+					if (converged)
+						break;
+				}
+			}
+			vranekEvaluateBatch(a, t, f, df, ddf);
+			for (int l = 0; l < LANES; l++) {
+				locMin[l] = (f[l] < 0 && f[l] > -1e-10) ? 0 : f[l];
+				locMinT[l] = t[l];
+				bool smaller = (locMin[l] < glMin[l]);
+				glMin[l] = smaller ? locMin[l] : glMin[l];
+				glMinT[l] = smaller ? locMinT[l] : glMinT[l];
+			}
+
+			// 2, 3. Formulate g(t) at the level of local minimum, reduce it into 2nd degree polynomial, and solve it
+			for (int l = 0; l < LANES; l++) {
+				Real
+					d[3] = { a[7][l] - locMin[l], a[6][l] * a[6][l], a[8][l] * a[8][l] },
+					c1 = 2.0 * a[8][l] * d[0] - d[1] * a[2][l],
+					c3 = d[0] * d[0] - d[1] * a[0][l] + d[2] - d[1] * a[4][l],
+					c4 = 2.0 * a[9][l] * d[0] - d[1] * a[3][l],
+					c5 = 2.0 * a[9][l] * a[8][l] - d[1] * a[1][l],
+					c6 = -d[2] + d[1] * a[4][l] + a[9][l] * a[9][l] - d[1] * a[5][l];
+				Real
+					coefB2 = c1 * c1 - c5 * c5 + 2.0 * c3 * c6 + c4 * c4,
+					coefB3 = 2.0 * c1 * c5 + 2.0 * c4 * c6,
+					coefB4 = c6 * c6 + c5 * c5;
+				Real
+					z = cos(locMinT[l]),
+					eq0 = coefB2 + 2.0 * coefB3 * z + 3.0 * coefB4 * z * z,
+					eq1 = coefB3 + 2.0 * coefB4 * z,
+					eq2 = coefB4;
+				Real
+					b_4ac = eq1 * eq1 - 4.0 * eq0 * eq2,
+					root_b_4ac = sqrt(std::max(b_4ac, (Real)0.0)),
+					cosa = (-eq1 + root_b_4ac) / (2.0 * eq2),
+					cosb = (-eq1 - root_b_4ac) / (2.0 * eq2);
+				valid[l] = (b_4ac >= 0.0) && (fabs(cosa) < 1 + 1e-5) && (fabs(cosb) < 1 + 1e-5);
+				cosRoot[0][l] = std::max((Real)-1.0, std::min((Real)1.0, cosa));
+				cosRoot[1][l] = std::max((Real)-1.0, std::min((Real)1.0, cosb));
+			}
+
+			// 4. Find real global minimum between neighbouring level set points; the
+			// roots are sorted around the circle so the interval across 0 is kept
+			Real ends[5][LANES], dends[5][LANES];
+			for (int l = 0; l < LANES; l++) {
+				Real ea = acos(cosRoot[0][l]), eb = acos(cosRoot[1][l]);
+				Real e0 = std::min(ea, eb), e1 = std::max(ea, eb);
+				ends[0][l] = e0;
+				ends[1][l] = e1;
+				ends[2][l] = PI20 - e1;
+				ends[3][l] = PI20 - e0;
+				ends[4][l] = PI20 + e0;
+			}
+			for (int k = 0; k < 4; k++)
+				vranekEvaluateBatch(a, ends[k], f, dends[k], ddf);
+			for (int l = 0; l < LANES; l++)
+				dends[4][l] = dends[0][l];
+			for (int k = 0; k < 4; k++) {
+				bool bracket[LANES], anyBracket = false;
+				for (int l = 0; l < LANES; l++) {
+					lo[l] = ends[k][l];
+					hi[l] = ends[k + 1][l];
+					bracket[l] = valid[l] && (dends[k][l] * dends[k + 1][l] < 0.0);
+					anyBracket |= bracket[l];
+				}
+				if (!anyBracket)
+					continue;
+				vranekBracketBatch(a, bracket, lo, hi, dends[k], t);
+				vranekEvaluateBatch(a, t, f, df, ddf);
+				for (int l = 0; l < LANES; l++) {
+					bool smaller = bracket[l] && (f[l] < glMin[l]);
+					glMin[l] = smaller ? f[l] : glMin[l];
+					glMinT[l] = smaller ? t[l] : glMinT[l];
+				}
+			}
+
+			// 5. Points on each circle
+			for (int l = 0; l < LANES && beg + l < batch.num; l++) {
+				int i = pair[l];
+				Real tb = piDomain::regularize(glMinT[l]);
+				Real rb = batch.radiusB[i];
+				Vec3 bpt{ rb * cos(tb), rb * sin(tb), 0.0 };
+				Vec3 bptA{
+					batch.center[0][i] + batch.axisU[0][i] * bpt[0] + batch.axisV[0][i] * bpt[1],
+					batch.center[1][i] + batch.axisU[1][i] * bpt[0] + batch.axisV[1][i] * bpt[1],
+					batch.center[2][i] + batch.axisU[2][i] * bpt[0] + batch.axisV[2][i] * bpt[1] };
+				Circle ca;
+				ca.radius = batch.radiusA[i];
+
+				Distance& dist = distances[i];
+				dist.length = sqrt(std::max(glMin[l], (Real)0.0));
+				dist.paramB[0] = tb;
+				dist.pointB = bpt;
+				ca.Circle::findMinDistParam(bptA, dist.paramA[0]);
+				dist.pointA = ca.evaluate(dist.paramA[0]);
+			}
+		}
+	}
+
+	// Selector
+	CircleDistanceSelector::Pose CircleDistanceSelector::classify(const Circle& a, const Circle& b, const Transform& btoa) const noexcept {
+		Real avgRadius = (a.radius + b.radius) * 0.5;
+		Real axisCos = fabs(btoa.R[2][2]);
+		Real centerDistSq = btoa.T.dot(btoa.T);
+
+		// Offset of [ b ]'s center from [ a ]'s axis, and [ a ]'s center from [ b ]'s axis
+		Real offsetB = sqrt(SQ(btoa.T[0]) + SQ(btoa.T[1]));
+		Real heightA = btoa.T[0] * btoa.R[0][2] + btoa.T[1] * btoa.R[1][2] + btoa.T[2] * btoa.R[2][2];
+		Real offsetA = sqrt(std::max(centerDistSq - SQ(heightA), (Real)0.0));
+
+		if (axisCos >= 1.0 - coaxialEps && offsetB < coaxialEps * avgRadius)
+			return Pose::Coaxial;
+		if (axisCos >= 1.0 - parallelEps)
+			return Pose::Parallel;
+		if (offsetB < axisCenterEps * avgRadius || offsetA < axisCenterEps * avgRadius)
+			return Pose::AxisCenter;
+		if (centerDistSq > SQ(separationRatio * (a.radius + b.radius)))
+			return Pose::Separated;
+		return Pose::General;
+	}
+	CircleDistanceStatus CircleDistanceSelector::distance(const Circle& a, const Circle& b, const Transform& tA, const Transform& tB, Distance& distance) noexcept {
+		Pose pose = classify(a, b, Transform::connect(tB, tA));
+		counters.poseNum[(int)pose]++;
+		if (methods[(int)pose] == Method::Binormal) {
+			counters.binormalNum++;
+			if (binormalDistance(a, b, tA, tB, distance))
+				return CircleDistanceStatus::Success;
+			counters.failureNum++;
+			return CircleDistanceStatus::Failure;
+		}
+		counters.vranekNum++;
+		CircleDistanceStatus status = MN::distance(a, b, tA, tB, distance);
+		if (status == CircleDistanceStatus::BracketFailure || status == CircleDistanceStatus::IterationFailure)
+			counters.fallbackNum++;
+		else if (status == CircleDistanceStatus::Failure)
+			counters.failureNum++;
+		return status;
+	}
+	void CircleDistanceSelector::calibrate(Calibration& calibration, int gridNum, int repeatNum) {
+		if (gridNum < 2 || repeatNum < 1)
+			throw(std::runtime_error("Invalid calibration grid"));
+		calibration = Calibration();
+		const Real radiusRatio[3] = { 0.2, 1.0, 5.0 };
+		Transform tA;
+		tA.clear();
+		Distance dist;
+		for (int r = 0; r < 3; r++) {
+			Circle a, b;
+			a.radius = 1.0;
+			b.radius = radiusRatio[r];
+			Real maxCenterDist = 1.5 * separationRatio * (a.radius + b.radius);
+			for (int i = 0; i < gridNum; i++) {
+				// Tilt [ b ]'s axis around X axis by [ angle ] in [ 0, PI / 2 ]
+				Real angle = PI05 * i / (gridNum - 1), c = cos(angle), s = sin(angle);
+				for (int j = 0; j < gridNum; j++) {
+					Real centerDist = maxCenterDist * j / (gridNum - 1);
+					for (int k = 0; k < gridNum; k++) {
+						// Direction of [ b ]'s center goes from A's plane ( k = 0 ) to A's axis ( k = gridNum - 1 ), off the tilt axis
+						Real elev = PI05 * k / (gridNum - 1);
+						Transform tB;
+						tB.clear();
+						tB.R[1][1] = c;
+						tB.R[1][2] = -s;
+						tB.R[2][1] = s;
+						tB.R[2][2] = c;
+						tB.T = { centerDist * cos(elev) * 0.6, centerDist * cos(elev) * 0.8, centerDist * sin(elev) };
+
+						int pose = (int)classify(a, b, tB);
+						calibration.pairNum[pose]++;
+						auto t0 = std::chrono::steady_clock::now();
+						for (int n = 0; n < repeatNum; n++)
+							MN::distance(a, b, tA, tB, dist);
+						auto t1 = std::chrono::steady_clock::now();
+						for (int n = 0; n < repeatNum; n++)
+							binormalDistance(a, b, tA, tB, dist);
+						auto t2 = std::chrono::steady_clock::now();
+						calibration.vranekTime[pose] += std::chrono::duration<double>(t1 - t0).count();
+						calibration.binormalTime[pose] += std::chrono::duration<double>(t2 - t1).count();
+					}
+				}
+			}
+		}
+		for (int p = 0; p < poseNum; p++) {
+			if (calibration.pairNum[p] == 0)
+				continue;
+			methods[p] = (calibration.binormalTime[p] < calibration.vranekTime[p]) ? Method::Binormal : Method::Vranek;
 		}
 	}
 }
\ No newline at end of file
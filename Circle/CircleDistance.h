@@ -14,13 +14,110 @@
 #endif
 
 #include "Circle.h"
+#include "CircleBinormal.h"
 #include "../Distance.h"
+#include "../Line.h"
+#include "../Polynomial.h"
 
 namespace MN {
+	// Result of exception-free circle distance
+	enum class CircleDistanceStatus {
+		Success,			// Found by the method in use : Vranek's algorithm, or binormals if [ CircleDistanceSelector ] routed the pair to them
+		BracketFailure,		// Initial triplet of Vranek's algorithm could not bracket local minimum, found by binormals instead
+		IterationFailure,	// Brent's method in Vranek's algorithm exceeded iteration limit, found by binormals instead
+		Failure				// Binormals could not be found either, so [ distance ] is not valid
+	};
 	// Find minimum distance between two circles by Vranek's algorithm
 	Distance distance(const Circle& a, const Circle& b, const Transform& tA, const Transform& tB);
+	// Same as above, but never throws, so that a single degenerate pair does not break a loop over many pairs
+	// If Vranek's algorithm fails, it falls back to the shortest binormal found by [ CircleBinormal::solveMin ]
+	// @distance : Result. Points are given in local coordinates of each circle
+	CircleDistanceStatus distance(const Circle& a, const Circle& b, const Transform& tA, const Transform& tB, Distance& distance) noexcept;
 	// Find minimum distance between two circular arcs by finding binormals
 	Distance distance(const CircularArc& a, const CircularArc& b, const Transform& tA, const Transform& tB);
+	// Find maximum distance between two circles ( or arcs ) by the longest binormal, found by [ CircleBinormal::solveMax ]
+	// Farthest points from a few points ( end points for arcs ) are examined first, so that binormals not longer than them are pruned
+	Distance maxDistance(const Circle& a, const Circle& b, const Transform& tA, const Transform& tB);
+	Distance maxDistance(const CircularArc& a, const CircularArc& b, const Transform& tA, const Transform& tB);
+	// Find minimum distance between a circle and a line ( or segment ) given in the circle's local coordinates
+	// Critical points of squared distance are roots of a quartic in cosine of the circle's parameter
+	// @return : [ pointA ] and [ paramA[0] ] are on the circle, [ pointB ] and [ paramB[0] ] on the line. Points are given in the circle's local coordinates
+	Distance distance(const Circle& circle, const Line& line);
+	Distance distance(const CircularArc& arc, const Line& line);
+	Distance distance(const Circle& circle, const Segment& segment);
+	Distance distance(const CircularArc& arc, const Segment& segment);
+	// Maximum number of [ lineCriticalParams ] : Both signs of sine for each root candidate of quartic in cosine and for cosine of -1, 1
+	const int lineCriticalMaxNum = 2 * (Polynomial::maxCandidateNum + 2);
+	// Parameters of the circle at critical points of squared distance between [ circle ] and [ line ], which is given in the circle's local coordinates
+	// Some of them may not be critical, but every critical point is included. If [ line ] is the axis of [ circle ], only 0 and PI are given
+	// @params : At most [ lineCriticalMaxNum ]
+	void lineCriticalParams(const Circle& circle, const Line& line, Real params[], int& paramNum);
+	// Find minimum distance between [ batch.num ] circle pairs by Vranek's algorithm
+	// Pairs are processed in lockstep, with fixed number of iterations instead of bracketing and Brent's method
+	// It is faster than [ distance ] per pair only when loops over lanes are vectorized, which needs -O3 -march=native -fno-math-errno
+	// ( with errno, [ sqrt ] keeps them scalar, and SSE2 alone cannot pay for the extra lockstep iterations ; see Benchmark/CircleDistanceBenchmark.cpp )
+	// @distances : Array of [ batch.num ] results. Points are given in local coordinates of each circle
+	void distance(const CircleBinormal::PairBatch& batch, Distance distances[]);
+
+	// Find minimum distance between two circles by Vranek's algorithm or the shortest binormal, whichever is faster for their relative pose
+	// Pose is classified cheaply from relative transform, and each class is routed to the method in [ methods ]
+	// Default [ methods ] come from [ calibrate ], and it can be run again to fit them to the target machine
+	class CircleDistanceSelector {
+	public:
+		enum class Method {
+			Vranek,			// [ distance ] with fallback to binormal
+			Binormal		// [ CircleBinormal::solveMin ]
+		};
+		enum class Pose {
+			General,
+			Coaxial,		// Two circles share axis, so every pair of points in the same direction is closest
+			Parallel,		// Axes are nearly parallel, including coplanar circles
+			AxisCenter,		// Center of a circle is near the axis of the other circle
+			Separated		// Two circles are far apart compared to their radii
+		};
+		static const int poseNum = 5;
+
+		// Number of pairs that fell in each class, and number of pairs that each method processed
+		struct Counters {
+			long long	poseNum[CircleDistanceSelector::poseNum] = { 0 };
+			long long	vranekNum = 0;
+			long long	binormalNum = 0;
+			long long	fallbackNum = 0;	// Pairs routed to Vranek's algorithm, but found by binormal
+			long long	failureNum = 0;		// Pairs that neither method could find ( [ CircleDistanceStatus::Failure ] )
+
+			inline void reset() noexcept {
+				*this = Counters();
+			}
+		};
+		// Time taken by each method for pairs of each class in [ calibrate ]
+		struct Calibration {
+			int			pairNum[CircleDistanceSelector::poseNum] = { 0 };
+			double		vranekTime[CircleDistanceSelector::poseNum] = { 0 };	// Seconds
+			double		binormalTime[CircleDistanceSelector::poseNum] = { 0 };	// Seconds
+		};
+
+		Real		coaxialEps = 1e-6;		// Tolerance of [ Pose::Coaxial ], for axis angle ( cosine ) and center offset ( scaled by average radius )
+		Real		parallelEps = 1e-3;		// Tolerance of [ Pose::Parallel ], for axis angle ( cosine )
+		Real		axisCenterEps = 1e-3;	// Tolerance of [ Pose::AxisCenter ], for center offset ( scaled by average radius )
+		Real		separationRatio = 4.0;	// [ Pose::Separated ] if distance between centers is larger than this times sum of radii
+		Method		methods[poseNum] = { Method::Vranek, Method::Binormal, Method::Vranek, Method::Vranek, Method::Vranek };
+		Counters	counters;
+
+		// Classify relative pose of two circles
+		// @btoa : Transformation from circle [ b ]'s local coordinates to [ a ]'s
+		Pose classify(const Circle& a, const Circle& b, const Transform& btoa) const noexcept;
+
+		// Same as exception-free [ distance ], but routed by pose
+		// It updates [ counters ] without synchronization, so a selector must not be shared across threads
+		// Copy it for each thread instead, and sum up their [ counters ] if needed
+		CircleDistanceStatus distance(const Circle& a, const Circle& b, const Transform& tA, const Transform& tB, Distance& distance) noexcept;
+
+		// Benchmark both methods over a grid of poses, and set [ methods ] of each class to the faster one
+		// Grid consists of [ gridNum ] axis angles X [ gridNum ] center distances X [ gridNum ] center directions X 3 radius ratios
+		// Classes without any pose on the grid keep their methods
+		// @repeatNum : Number of times each pose is solved by each method
+		void calibrate(Calibration& calibration, int gridNum = 8, int repeatNum = 8);
+	};
 }
 
 #endif
\ No newline at end of file
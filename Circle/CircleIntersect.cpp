@@ -7,6 +7,10 @@
  */
 
 #include "CircleIntersect.h"
+#include <algorithm>
+
+#define INTERSECT_EPS		1e-8	// Tolerance of circle - circle intersection, relative to the larger radius
+#define INTERSECT_NR_ITER	4		// Number of Newton steps to refine circle - circle intersection
 
 namespace MN {
 	inline static void solveQuadraticEquation(const Real c[3], Real roots[2], int& num) {
@@ -88,7 +92,7 @@ namespace MN {
 			for (int i = 0; i < cosnum; i++) {
 				if (fabs(cosu[i]) > 1) {
 					if (fabs(cosu[i]) < 1 + 1e-10) {
-						if (cosu > 0) cosu[i] = 1;
+						if (cosu[i] > 0) cosu[i] = 1;
 						else cosu[i] = -1;
 					}
 					else
@@ -158,7 +162,7 @@ namespace MN {
 			for (int i = 0; i < cosnum; i++) {
 				if (fabs(cosu[i]) > 1) {
 					if (fabs(cosu[i]) < 1 + 1e-10) {
-						if (cosu > 0) cosu[i] = 1;
+						if (cosu[i] > 0) cosu[i] = 1;
 						else cosu[i] = -1;
 					}
 					else
@@ -173,4 +177,205 @@ namespace MN {
 		}
 		return 1;
 	}
+	// Batch
+	// Intersecting parameters of circle of [ radius ] and the plane { x | dot(n, x) = offset }, where [ n ] is unit vector
+	// ( [ rho ], [ phi ] ) is polar form of ( n[0], n[1] ), so the circle point at [ t ] is on the plane if radius * rho * cos(t - phi) = offset
+	inline static int planeParams(Real radius, Real rho, Real phi, Real offset, Real intParam[2], int& intNum) {
+		intNum = 0;
+		if (rho == 0) {
+			// Plane is parallel to the circle
+			return (offset == 0) ? 0 : 1;
+		}
+		Real cosv = offset / (radius * rho);
+		if (fabs(cosv) > 1 + 1e-10)
+			return 1;
+		cosv = std::min(std::max(cosv, -1.0), 1.0);
+		Real a = acos(cosv);
+		intParam[intNum++] = piDomain::regularize(phi + a);
+		if (fabs(cosv) != 1)
+			intParam[intNum++] = piDomain::regularize(phi - a);
+		return 1;
+	}
+	// Discard intersecting parameters out of [ arc ]'s domain
+	inline static void arcParams(const CircularArc& arc, Real intParam[2], int& intNum) {
+		int num = 0;
+		for (int i = 0; i < intNum; i++)
+			if (arc.domain.has(intParam[i]))
+				intParam[num++] = intParam[i];
+		intNum = num;
+	}
+	void intersect(const Circle& circle, int num, const Vec3 planeNormals[], const Vec3 planePoints[], Real intParams[][2], int intNums[], int rets[]) {
+		for (int i = 0; i < num; i++) {
+			auto pn = planeNormals[i];
+			pn.normalize();
+			Real rho = sqrt(SQ(pn[0]) + SQ(pn[1]));
+			rets[i] = planeParams(circle.radius, rho, atan2(pn[1], pn[0]), pn.dot(planePoints[i]), intParams[i], intNums[i]);
+		}
+	}
+	void intersect(const CircularArc& arc, int num, const Vec3 planeNormals[], const Vec3 planePoints[], Real intParams[][2], int intNums[], int rets[]) {
+		const Circle& circle = arc;
+		intersect(circle, num, planeNormals, planePoints, intParams, intNums, rets);
+		for (int i = 0; i < num; i++)
+			arcParams(arc, intParams[i], intNums[i]);
+	}
+	void intersect(const Circle& circle, const Vec3& planeNormal, int num, const Real planeOffsets[], Real intParams[][2], int intNums[], int rets[]) {
+		auto pn = planeNormal;
+		pn.normalize();
+		const Real rho = sqrt(SQ(pn[0]) + SQ(pn[1]));
+		if (rho == 0) {
+			for (int i = 0; i < num; i++) {
+				intNums[i] = 0;
+				rets[i] = (planeOffsets[i] == 0) ? 0 : 1;
+			}
+			return;
+		}
+
+		// Without branches, so that the loop can be vectorized
+		const Real
+			phi = atan2(pn[1], pn[0]),
+			scale = 1.0 / (circle.radius * rho);
+		for (int i = 0; i < num; i++) {
+			Real
+				cosv = planeOffsets[i] * scale,
+				clamped = std::min(std::max(cosv, -1.0), 1.0),
+				a = acos(clamped),
+				t0 = phi + a,
+				t1 = phi - a;
+			t0 += (t0 < 0) ? PI20 : 0.0;
+			t0 -= (t0 >= PI20) ? PI20 : 0.0;
+			t1 += (t1 < 0) ? PI20 : 0.0;
+			t1 -= (t1 >= PI20) ? PI20 : 0.0;
+			intParams[i][0] = t0;
+			intParams[i][1] = t1;
+			intNums[i] = (fabs(cosv) > 1 + 1e-10) ? 0 : ((fabs(clamped) == 1) ? 1 : 2);
+			rets[i] = 1;
+		}
+	}
+	void intersect(const CircularArc& arc, const Vec3& planeNormal, int num, const Real planeOffsets[], Real intParams[][2], int intNums[], int rets[]) {
+		const Circle& circle = arc;
+		intersect(circle, planeNormal, num, planeOffsets, intParams, intNums, rets);
+		for (int i = 0; i < num; i++)
+			arcParams(arc, intParams[i], intNums[i]);
+	}
+
+	// Parameter of [ b ] at [ pt ], which is given in [ a ]'s local coordinates
+	inline static Real circleParam(const Circle& b, const Transform& btoa, const Vec3& pt) {
+		Vec3 d = pt - btoa.T, ptB{
+			btoa.R[0][0] * d[0] + btoa.R[1][0] * d[1] + btoa.R[2][0] * d[2],
+			btoa.R[0][1] * d[0] + btoa.R[1][1] * d[1] + btoa.R[2][1] * d[2],
+			0 };
+		Real param;
+		b.Circle::findMinDistParam(ptB, param);
+		return param;
+	}
+	// Intersection of two full circles on the same plane ( [ b ] is projected onto [ a ]'s plane )
+	static int coplanarIntersect(const Circle& a, const Circle& b, const Transform& btoa, Real eps, Real2 intParam[2], Vec3 intPoint[2], int& intNum) {
+		const Real
+			rA = a.radius,
+			rB = b.radius;
+		const Vec3
+			cB = btoa.T;
+
+		intNum = 0;
+		Real d2 = SQ(cB[0]) + SQ(cB[1]), d = sqrt(d2);
+		if (d < eps) {
+			if (fabs(rA - rB) < eps)
+				return 0;
+			return 1;		// Concentric circles
+		}
+		Real
+			x = (d2 + SQ(rA) - SQ(rB)) / (2 * d),		// Distance from [ a ]'s center to the common chord
+			h2 = SQ(rA) - SQ(x);						// Squared half length of the common chord
+		if (h2 < 0) {
+			// Separated or nested, unless they touch within tolerance
+			if (fabs(d - rA - rB) > eps && fabs(d - fabs(rA - rB)) > eps)
+				return 1;
+			h2 = 0;
+		}
+		Real
+			h = sqrt(h2),
+			ux = cB[0] / d,
+			uy = cB[1] / d;
+		intPoint[intNum++] = Vec3{ x * ux - h * uy, x * uy + h * ux, 0 };
+		if (h > eps)
+			intPoint[intNum++] = Vec3{ x * ux + h * uy, x * uy - h * ux, 0 };
+		for (int i = 0; i < intNum; i++) {
+			a.Circle::findMinDistParam(intPoint[i], intParam[i].first);
+			intParam[i].second = circleParam(b, btoa, intPoint[i]);
+		}
+		return 1;
+	}
+	// Intersection of two full circles
+	static int circleIntersect(const Circle& a, const Circle& b, const Transform& btoa, Real2 intParam[2], Vec3 intPoint[2], int& intNum) {
+		const Real
+			rA = a.radius,
+			rB = b.radius,
+			eps = INTERSECT_EPS * (rA > rB ? rA : rB);
+		const Vec3
+			nB{ btoa.R[0][2], btoa.R[1][2], btoa.R[2][2] },		// Normal of [ b ]'s plane
+			cB = btoa.T;										// Center of [ b ]
+		
+		intNum = 0;
+		if (fabs(cB[2]) + sqrt(SQ(nB[0]) + SQ(nB[1])) * rB < eps) {
+			// [ b ] is in [ a ]'s plane within tolerance, so intersect them in 2D
+			return coplanarIntersect(a, b, btoa, eps, intParam, intPoint, intNum);
+		}
+
+		// Points of [ a ] on [ b ]'s plane are intersecting points if they are also on the sphere of [ b ]
+		// If [ a ] is ( nearly ) in [ b ]'s plane, more than 2 points can be on the plane, and it throws
+		Real params[2];
+		int paramNum, ret;
+		try {
+			ret = intersect(a, nB, cB, params, paramNum);
+		}
+		catch (const char*) {
+			ret = 0;
+		}
+		if (ret == 0)
+			return coplanarIntersect(a, b, btoa, eps, intParam, intPoint, intNum);
+
+		for (int i = 0; i < paramNum; i++) {
+			// As [ b ]'s plane gets parallel to [ a ], the points drift along [ a ], since the plane cuts [ a ] at a small angle
+			// The sphere of [ b ] still cuts [ a ] at a large angle, so refine the points on it by Newton's method
+			Real t = params[i];
+			for (int k = 0; k < INTERSECT_NR_ITER; k++) {
+				Vec3
+					diff = a.evaluate(t) - cB,
+					deriv = a.differentiate(t, 1);
+				Real
+					f = diff.dot(diff) - SQ(rB),
+					df = 2.0 * diff.dot(deriv);
+				if (fabs(df) < eps * rA)
+					break;		// [ a ] is tangent to the sphere
+				t -= f / df;
+			}
+			Vec3 pt = a.evaluate(t);
+			if (fabs(pt.dist(cB) - rB) < eps && fabs(nB.dot(pt - cB)) < eps) {
+				intPoint[intNum] = pt;
+				intParam[intNum].first = piDomain::regularize(t);
+				intParam[intNum].second = circleParam(b, btoa, pt);
+				intNum++;
+			}
+		}
+		return 1;
+	}
+	int intersect(const Circle& a, const Circle& b, const Transform& btoa, Real2 intParam[2], Vec3 intPoint[2], int& intNum) {
+		return circleIntersect(a, b, btoa, intParam, intPoint, intNum);
+	}
+	int intersect(const CircularArc& a, const CircularArc& b, const Transform& btoa, Real2 intParam[2], Vec3 intPoint[2], int& intNum) {
+		if (circleIntersect(a, b, btoa, intParam, intPoint, intNum) == 0)
+			return 0;
+
+		// Discard intersecting points out of arc domains
+		int num = 0;
+		for (int i = 0; i < intNum; i++) {
+			if (a.domain.has(intParam[i].first) && b.domain.has(intParam[i].second)) {
+				intParam[num] = intParam[i];
+				intPoint[num] = intPoint[i];
+				num++;
+			}
+		}
+		intNum = num;
+		return 1;
+	}
 }
\ No newline at end of file
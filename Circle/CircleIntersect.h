@@ -27,6 +27,32 @@ namespace MN {
 
 	// Arc version of above
 	int intersect(const CircularArc& arc, const Vec3& planeNormal, const Vec3& planePoint, Real intParam[2], int& intNum);
+
+	// Circle - Plane intersection for [ num ] planes at once
+	// Circle point at [ t ] is on the plane if ( n[0] * cos(t) + n[1] * sin(t) ) * radius = offset, which is solved in closed form
+	// @ planeNormals, planePoints : Arrays of [ num ] planes in [ circle ]'s local coordinates
+	// @ intParams, intNums : Intersecting parameters of i-th plane are [ intParams[i][0], ..., intParams[i][intNums[i] - 1] ]
+	// @ rets : Return values of single plane version for each plane
+	void intersect(const Circle& circle, int num, const Vec3 planeNormals[], const Vec3 planePoints[], Real intParams[][2], int intNums[], int rets[]);
+	void intersect(const CircularArc& arc, int num, const Vec3 planeNormals[], const Vec3 planePoints[], Real intParams[][2], int intNums[], int rets[]);
+
+	// Same as above, but for [ num ] parallel planes that share [ planeNormal ] ( e.g. slices at many levels )
+	// Projection of [ planeNormal ] onto the plane of [ circle ] is computed only once
+	// @ planeOffsets : i-th plane is { x | dot(n, x) = planeOffsets[i] }, where [ n ] is normalized [ planeNormal ]
+	void intersect(const Circle& circle, const Vec3& planeNormal, int num, const Real planeOffsets[], Real intParams[][2], int intNums[], int rets[]);
+	void intersect(const CircularArc& arc, const Vec3& planeNormal, int num, const Real planeOffsets[], Real intParams[][2], int intNums[], int rets[]);
+
+	// Circle - Circle intersection
+	// @ btoa : Transformation from [ b ]'s local coordinates to [ a ]'s local coordinates
+	// @ intParam : Intersecting parameters as ( parameter of [ a ], parameter of [ b ] )
+	// @ intPoint : Intersecting points in [ a ]'s local coordinates
+	// @ intNum : Number of intersecting points ( At most 2 )
+	// @ ret :	0 = [ a ] and [ b ] are the same circle, so all points on them are intersecting points
+	//			1 = [ a ] and [ b ] are different circles, so at most 2 points of intersection occurred
+	int intersect(const Circle& a, const Circle& b, const Transform& btoa, Real2 intParam[2], Vec3 intPoint[2], int& intNum);
+
+	// Arc version of above ( If 0 is returned, two arcs are on the same circle but they may not overlap )
+	int intersect(const CircularArc& a, const CircularArc& b, const Transform& btoa, Real2 intParam[2], Vec3 intPoint[2], int& intNum);
 }
 
 #endif
\ No newline at end of file
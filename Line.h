@@ -0,0 +1,45 @@
+/*
+ *******************************************************************************************
+ * Author	: Sang Hyun Son
+ * Email	: shh1295@gmail.com
+ * Github	: github.com/SonSang
+ *******************************************************************************************
+ */
+
+#ifndef __MN_LINE_H__
+#define __MN_LINE_H__
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#include "../MinuteUtils/Utils.h"
+
+namespace MN {
+	// Infinite line [ point + s * direction ]
+	class Line {
+	public:
+		Vec3 point;
+		Vec3 direction;
+	};
+	// Line segment [ beg + s * ( end - beg ) ], s in [ 0, 1 ]
+	class Segment {
+	public:
+		Vec3 beg;
+		Vec3 end;
+	};
+	// Half line [ origin + t * direction ], t >= 0
+	class Ray {
+	public:
+		Vec3 origin;
+		Vec3 direction;
+	};
+	// Set of points within [ radius ] from [ segment ]
+	class Capsule {
+	public:
+		Segment segment;
+		Real radius;
+	};
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,119 @@
+/*
+ *******************************************************************************************
+ * Author	: Sang Hyun Son
+ * Email	: shh1295@gmail.com
+ * Github	: github.com/SonSang
+ *******************************************************************************************
+ */
+
+#ifndef __MN_POLYNOMIAL_H__
+#define __MN_POLYNOMIAL_H__
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#include "../MinuteUtils/Utils.h"
+#include <algorithm>
+
+namespace MN {
+	// Real polynomials of low degree, shared by distance and intersection queries
+	class Polynomial {
+	public:
+		static const int maxCandidateNum = 10;		// Maximum number of root candidates of polynomial of degree 4 ( see [ rootCandidates ] )
+
+		// Evaluate polynomial with coefficients in ascending order, and its derivative
+		inline static Real evaluate(const Real coef[], int degree, Real x, Real& deriv) {
+			Real value = coef[degree];
+			deriv = 0.0;
+			for (int i = degree - 1; i >= 0; i--) {
+				deriv = deriv * x + value;
+				value = value * x + coef[i];
+			}
+			return value;
+		}
+		// Root of polynomial in [ x0, x1 ], where it is monotone and changes sign ( [ v0 ], [ v1 ] are values at [ x0 ], [ x1 ] )
+		// Newton steps safeguarded by bisection converge to the single root
+		inline static Real monotoneRoot(const Real coef[], int degree, Real x0, Real x1, Real v0, Real v1) {
+			const static Real eps = 1e-12;		// Step size where root search stops
+			const static int itermax = 64;		// Maximum number of safeguarded Newton steps
+			Real a = x0, b = x1, x = x0 - v0 * (x1 - x0) / (v1 - v0), deriv;
+			for (int k = 0; k < itermax; k++) {
+				Real value = evaluate(coef, degree, x, deriv);
+				if (value == 0.0)
+					break;
+				if ((value < 0.0) == (v0 < 0.0)) a = x;
+				else b = x;
+				Real nx = x - value / deriv;
+				if (!(nx > a && nx < b))
+					nx = 0.5 * (a + b);
+				if (fabs(nx - x) <= eps)
+					return nx;
+				x = nx;
+			}
+			return x;
+		}
+		// Candidates of real roots of polynomial ( degree <= 4, ascending order ) in [ lo, hi ]
+		// Roots are isolated between critical points, which are found recursively from derivative
+		// Critical points are candidates as well, since roots of even multiplicity do not change sign
+		// Distinct candidates of quartic are at most 4 roots and 6 candidates of its derivative, but rounding near multiple roots can give more,
+		// so the rest are dropped
+		// @candidates : At most [ maxCandidateNum ]
+		static void rootCandidates(const Real coef[], int degree, Real lo, Real hi, Real candidates[], int& candidateNum) {
+			const static Real eps = 1e-12;		// Relative size of leading coefficient regarded as zero
+			candidateNum = 0;
+			Real scale = 0.0;
+			for (int i = 0; i <= degree; i++)
+				scale = std::max(scale, fabs(coef[i]));
+			while (degree > 0 && fabs(coef[degree]) <= eps * scale)
+				degree--;
+			if (degree == 0)
+				return;
+			if (degree == 1) {
+				Real x = -coef[0] / coef[1];
+				if (x >= lo && x <= hi)
+					candidates[candidateNum++] = x;
+				return;
+			}
+
+			Real dcoef[4], crits[maxCandidateNum];
+			int critNum;
+			for (int i = 0; i < degree; i++)
+				dcoef[i] = (i + 1) * coef[i + 1];
+			rootCandidates(dcoef, degree - 1, lo, hi, crits, critNum);
+			for (int i = 1; i < critNum; i++) {
+				// Insertion sort, since there are only a few
+				Real x = crits[i];
+				int j = i;
+				for (; j > 0 && crits[j - 1] > x; j--)
+					crits[j] = crits[j - 1];
+				crits[j] = x;
+			}
+			critNum = (int)(std::unique(crits, crits + critNum) - crits);
+
+			Real x0 = lo, deriv, v0 = evaluate(coef, degree, lo, deriv);
+			for (int i = 0; i <= critNum; i++) {
+				Real
+					x1 = (i < critNum) ? crits[i] : hi,
+					v1 = evaluate(coef, degree, x1, deriv);
+				if (v0 == 0.0)
+					addCandidate(x0, candidates, candidateNum);
+				else if (v0 * v1 < 0.0)
+					addCandidate(monotoneRoot(coef, degree, x0, x1, v0, v1), candidates, candidateNum);
+				x0 = x1;
+				v0 = v1;
+			}
+			if (v0 == 0.0)
+				addCandidate(hi, candidates, candidateNum);
+			for (int i = 0; i < critNum; i++)
+				addCandidate(crits[i], candidates, candidateNum);
+		}
+	private:
+		inline static void addCandidate(Real x, Real candidates[], int& candidateNum) {
+			if (candidateNum < maxCandidateNum)
+				candidates[candidateNum++] = x;
+		}
+	};
+}
+
+#endif
\ No newline at end of file
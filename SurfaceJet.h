@@ -0,0 +1,30 @@
+/*
+ *******************************************************************************************
+ * Author	: Sang Hyun Son
+ * Email	: shh1295@gmail.com
+ * Github	: github.com/SonSang
+ *******************************************************************************************
+ */
+
+#ifndef __MN_SURFACE_JET_H__
+#define __MN_SURFACE_JET_H__
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#include "../MinuteUtils/Utils.h"
+
+namespace MN {
+	// Position and partial derivatives up to 3rd order of parametric surface [ S(u, v) ] at one parameter
+	// Index of each member tells differentiation order, e.g. [ Suuv ] is differentiated twice by [ u ] and once by [ v ]
+	class SurfaceJet {
+	public:
+		Vec3 S;
+		Vec3 Su, Sv;
+		Vec3 Suu, Suv, Svv;
+		Vec3 Suuu, Suuv, Suvv, Svvv;
+	};
+}
+
+#endif
\ No newline at end of file
@@ -14,9 +14,12 @@
 #endif
 
 #include "../Circle/Circle.h"
+#include "../SurfaceJet.h"
 
 namespace MN {
-	class Cylinder {
+	// Geometry of cylinder without any virtual function, shared by [ Cylinder ] and static cylinder primitives ( [ StaticCylinder ] )
+	// Parameter queries along [ v ] do not depend on [ u ] domain, so they are also given here
+	class CylinderShape {
 	public:
 		Real radius;
 		Domain vDomain;
@@ -69,6 +72,25 @@ namespace MN {
 			else
 				throw(std::runtime_error("Invalid cylinder differentiation order"));
 		}
+		// Position and all partial derivatives up to 3rd order, sharing one pair of sine and cosine
+		// Derivatives by [ v ] are constant, since cylinder is linear in [ v ]
+		inline SurfaceJet jet(Real u, Real v) const noexcept {
+			Real
+				rc = radius * cos(u),
+				rs = radius * sin(u);
+			SurfaceJet J;
+			J.S = { rc, rs, v };
+			J.Su = { -rs, rc, 0.0 };
+			J.Sv = { 0.0, 0.0, 1.0 };
+			J.Suu = { -rc, -rs, 0.0 };
+			J.Suv = { 0.0, 0.0, 0.0 };
+			J.Svv = { 0.0, 0.0, 0.0 };
+			J.Suuu = { rs, -rc, 0.0 };
+			J.Suuv = { 0.0, 0.0, 0.0 };
+			J.Suvv = { 0.0, 0.0, 0.0 };
+			J.Svvv = { 0.0, 0.0, 0.0 };
+			return J;
+		}
 		inline Vec3 normal(Real u, Real v) const {
 			Vec3
 				Su = differentiate(u, v, 1, 0),
@@ -85,38 +107,11 @@ namespace MN {
 		}
 
 		/* Parameter */
-		// Find parameter [ u0 ] such that [ MC(u0) ] is the closest point on major circle [ MC(u) ] to the given point [ pt ]
-		// @return : 
-		// @ 0 = Since [ pt ] is on the axis of this cylinder, there is no unique [ u ]
-		// @ 1 = Unique [ u0 ]
-		inline virtual int findMinDistParamU(const Vec3& pt, Real& u) const {
-			auto mc = majorCircle();
-			return mc.findMinDistParam(pt, u);
-		}
-
-		// Find parameter [ u0 ] such that [ MC(u0) ] is the farthest point on major circle [ MC(u) ] to the given point [ pt ]
-		// @return : 
-		// @ 0 = Since [ pt ] is on the axis of this cylinder, there is no unique [ u ]
-		// @ 1 = Unique [ u0 ]
-		inline virtual int findMaxDistParamU(const Vec3& pt, Real& u) const {
-			auto mc = majorCircle();
-			return mc.findMaxDistParam(pt, u);
-		}
-
-		// Find parameter [ u0 & u1 ] such that [ MC(u0), MC(u1) ] are the closest & farthest point on major circle [ MC(u) ] to the given point [ pt ]
-		// @return : 
-		// @ 0 = Since [ pt ] is on the axis of this cylinder, there is no unique [ u0, u1 ]
-		// @ 1 = Unique [ u0, u1 ]
-		inline virtual int findExtDistParamU(const Vec3& pt, Real& minU, Real& maxU) const {
-			auto mc = majorCircle();
-			return mc.findExtDistParam(pt, minU, maxU);
-		}
-
 		// Find parameter [ v0 ] such that [ T(u, v0) ] is the closest point on cylinder [ T(u, v) ] to the given point [ pt ]
 		// @return : 
 		// @ 0 = [ v ] falls to the boundary of this cylinder
 		// @ 1 = [ v ] falls to the inner part of this cylinder
-		inline virtual int findMinDistParamV(const Vec3& pt, Real u, Real& v) const {
+		inline int findMinDistParamV(const Vec3& pt, Real u, Real& v) const {
 			if (pt[2] > vDomain.end()) {
 				v = vDomain.end();
 				return 0;
@@ -135,7 +130,7 @@ namespace MN {
 		// @return : 
 		// @ 0 = [ v ] falls to the boundary of this cylinder
 		// @ 1 = [ v ] falls to the inner part of this cylinder
-		inline virtual int findMaxDistParamV(const Vec3& pt, Real u, Real& v) const {
+		inline int findMaxDistParamV(const Vec3& pt, Real u, Real& v) const {
 			Real d0 = fabs(pt[2] - vDomain.beg());
 			Real d1 = fabs(pt[2] - vDomain.end());
 			if (d0 < d1)
@@ -151,7 +146,7 @@ namespace MN {
 		// @ 1 = [ minV ] is on boundary, [ maxV ] is on inner ( of domain )
 		// @ 2 = [ minV ] is on inner, [ maxV ] is on boundary ( of domain )
 		// @ 3 = [ minV ] is on inner, [ maxV ] is on inner ( of domain )
-		inline virtual int findExtDistParamV(const Vec3& pt, Real u, Real& minV, Real& maxV) const {
+		inline int findExtDistParamV(const Vec3& pt, Real u, Real& minV, Real& maxV) const {
 			int result0 = findMinDistParamV(pt, u, minV);
 			int result1 = findMaxDistParamV(pt, u, maxV);
 			if (result0 == 0 && result1 == 0)
@@ -163,6 +158,52 @@ namespace MN {
 			else
 				return 3;
 		}
+	};
+
+	class Cylinder : public CylinderShape {
+	public:
+		/* Parameter */
+		// Find parameter [ u0 ] such that [ MC(u0) ] is the closest point on major circle [ MC(u) ] to the given point [ pt ]
+		// @return : 
+		// @ 0 = Since [ pt ] is on the axis of this cylinder, there is no unique [ u ]
+		// @ 1 = Unique [ u0 ]
+		inline virtual int findMinDistParamU(const Vec3& pt, Real& u) const {
+			auto mc = majorCircle();
+			return mc.findMinDistParam(pt, u);
+		}
+
+		// Find parameter [ u0 ] such that [ MC(u0) ] is the farthest point on major circle [ MC(u) ] to the given point [ pt ]
+		// @return : 
+		// @ 0 = Since [ pt ] is on the axis of this cylinder, there is no unique [ u ]
+		// @ 1 = Unique [ u0 ]
+		inline virtual int findMaxDistParamU(const Vec3& pt, Real& u) const {
+			auto mc = majorCircle();
+			return mc.findMaxDistParam(pt, u);
+		}
+
+		// Find parameter [ u0 & u1 ] such that [ MC(u0), MC(u1) ] are the closest & farthest point on major circle [ MC(u) ] to the given point [ pt ]
+		// @return : 
+		// @ 0 = Since [ pt ] is on the axis of this cylinder, there is no unique [ u0, u1 ]
+		// @ 1 = Unique [ u0, u1 ]
+		inline virtual int findExtDistParamU(const Vec3& pt, Real& minU, Real& maxU) const {
+			auto mc = majorCircle();
+			return mc.findExtDistParam(pt, minU, maxU);
+		}
+
+		// See [ CylinderShape::findMinDistParamV ]
+		inline virtual int findMinDistParamV(const Vec3& pt, Real u, Real& v) const {
+			return CylinderShape::findMinDistParamV(pt, u, v);
+		}
+
+		// See [ CylinderShape::findMaxDistParamV ]
+		inline virtual int findMaxDistParamV(const Vec3& pt, Real u, Real& v) const {
+			return CylinderShape::findMaxDistParamV(pt, u, v);
+		}
+
+		// See [ CylinderShape::findExtDistParamV ]
+		inline virtual int findExtDistParamV(const Vec3& pt, Real u, Real& minV, Real& maxV) const {
+			return CylinderShape::findExtDistParamV(pt, u, minV, maxV);
+		}
 
 		// Find parameter [ u0, v0 ] such that [ T(u0, v0) ] is the closest point on cylinder [ T(u, v) ] to the given point [ pt ]
 		// @return : 
@@ -390,6 +431,129 @@ namespace MN {
 			return result;
 		}
 	};
+
+	/*
+	 * Static ( non-virtual ) cylinder primitives, see [ TorusQuery ] for the idea
+	 *  [ Derived ] has to provide [ evaluate ] and [ find( Min | Max | Ext )DistParam( U | V ) ].
+	 */
+	template<typename Derived>
+	class CylinderQuery {
+	public:
+		/* Parameter */
+		// See [ Cylinder::findMinDistParam ]
+		inline int findMinDistParam(const Vec3& pt, Real& u, Real& v) const {
+			int uresult = derived().findMinDistParamU(pt, u);
+			derived().findMinDistParamV(pt, u, v);
+			return uresult;
+		}
+		// See [ Cylinder::findMaxDistParam ]
+		inline int findMaxDistParam(const Vec3& pt, Real& u, Real& v) const {
+			int uresult = derived().findMaxDistParamU(pt, u);
+			derived().findMaxDistParamV(pt, u, v);
+			return uresult;
+		}
+		// See [ Cylinder::findExtDistParam ]
+		inline int findExtDistParam(const Vec3& pt, Real2& minParam, Real2& maxParam) const {
+			int uresult = derived().findExtDistParamU(pt, minParam.first, maxParam.first);
+			if (uresult == 0) {
+				derived().findExtDistParamV(pt, minParam.first, minParam.second, maxParam.second);
+				return 0;
+			}
+			else {
+				derived().findMinDistParamV(pt, minParam.first, minParam.second);
+				derived().findMaxDistParamV(pt, maxParam.first, maxParam.second);
+				return 1;
+			}
+		}
+
+		/* Point */
+		// See [ Cylinder::findMinDistPoint ]
+		inline int findMinDistPoint(const Vec3& pt, Vec3& fpt) const {
+			Real u, v;
+			int result = findMinDistParam(pt, u, v);
+			fpt = derived().evaluate(u, v);
+			return result;
+		}
+		// See [ Cylinder::findMaxDistPoint ]
+		inline int findMaxDistPoint(const Vec3& pt, Vec3& fpt) const {
+			Real u, v;
+			int result = findMaxDistParam(pt, u, v);
+			fpt = derived().evaluate(u, v);
+			return result;
+		}
+		// See [ Cylinder::findExtDistPoint ]
+		inline int findExtDistPoint(const Vec3& pt, Vec3& minfpt, Vec3& maxfpt) const {
+			Real2 minp, maxp;
+			int result = findExtDistParam(pt, minp, maxp);
+			minfpt = derived().evaluate(minp.first, minp.second);
+			maxfpt = derived().evaluate(maxp.first, maxp.second);
+			return result;
+		}
+	private:
+		inline const Derived& derived() const noexcept {
+			return static_cast<const Derived&>(*this);
+		}
+	};
+
+	// Static version of [ Cylinder ]
+	class StaticCylinder : public CylinderShape, public CylinderQuery<StaticCylinder> {
+	public:
+		static inline StaticCylinder create(const CylinderShape& cylinder) noexcept {
+			StaticCylinder sc;
+			sc.radius = cylinder.radius;
+			sc.vDomain = cylinder.vDomain;
+			return sc;
+		}
+
+		/* Parameter */
+		// See [ Cylinder::findMinDistParamU ]
+		inline int findMinDistParamU(const Vec3& pt, Real& u) const {
+			return majorCircle().Circle::findMinDistParam(pt, u);
+		}
+		// See [ Cylinder::findMaxDistParamU ]
+		inline int findMaxDistParamU(const Vec3& pt, Real& u) const {
+			return majorCircle().Circle::findMaxDistParam(pt, u);
+		}
+		// See [ Cylinder::findExtDistParamU ]
+		inline int findExtDistParamU(const Vec3& pt, Real& minU, Real& maxU) const {
+			return majorCircle().Circle::findExtDistParam(pt, minU, maxU);
+		}
+	};
+
+	// Static version of [ CylinderPatch ]
+	class StaticCylinderPatch : public CylinderShape, public CylinderQuery<StaticCylinderPatch> {
+	public:
+		piDomain uDomain;
+
+		static inline StaticCylinderPatch create(const CylinderPatch& patch) noexcept {
+			StaticCylinderPatch sp;
+			sp.radius = patch.radius;
+			sp.vDomain = patch.vDomain;
+			sp.uDomain = patch.uDomain;
+			return sp;
+		}
+
+		inline CircularArc majorCircularArc() const noexcept {
+			CircularArc mc;
+			mc.radius = radius;
+			mc.domain = uDomain;
+			return mc;
+		}
+
+		/* Parameter */
+		// See [ CylinderPatch::findMinDistParamU ]
+		inline int findMinDistParamU(const Vec3& pt, Real& u) const {
+			return majorCircularArc().CircularArc::findMinDistParam(pt, u);
+		}
+		// See [ CylinderPatch::findMaxDistParamU ]
+		inline int findMaxDistParamU(const Vec3& pt, Real& u) const {
+			return majorCircularArc().CircularArc::findMaxDistParam(pt, u);
+		}
+		// See [ CylinderPatch::findExtDistParamU ]
+		inline int findExtDistParamU(const Vec3& pt, Real& minU, Real& maxU) const {
+			return majorCircularArc().CircularArc::findExtDistParam(pt, minU, maxU);
+		}
+	};
 }
 
 #endif
\ No newline at end of file
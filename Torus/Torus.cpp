@@ -1,7 +1,12 @@
 #include "Torus.h"
+#include <algorithm>
+#include <thread>
+#include <vector>
 
 #define NR_MAX_ITER		20
 #define LUDCMP_EPS		1.0e-20
+#define BATCH_BLOCK		256			// Number of points projected together in batch queries, small enough to keep temporaries in stack
+#define BATCH_THREAD	16384		// Minimum number of points for each thread in batch queries
 
 namespace MN {
 	inline static bool ludcmp(Real a[3][3], int* idx, Real* d) {
@@ -77,7 +82,8 @@ namespace MN {
 
 
 
-	void Torus::minDistParamRefine(const Vec3& pt, Real& u, Real& v) const {
+	// Refine closest point on [ torus ] to [ pt ], shared by [ Torus ] and [ StaticTorus ]
+	static void torusMinDistParamRefine(const TorusShape& torus, const Vec3& pt, Real& u, Real& v) {
 		// Use KKT condition & Simple gradient descent
 		const static Real eps = 1e-11;
 		Vec3 T, Tu, Tv, Tuu, Tuv, Tvv, diff;
@@ -86,7 +92,7 @@ namespace MN {
 		u = piDomain::regularize(u);
 		v = piDomain::regularize(v);
 
-		T = evaluate(u, v);
+		T = torus.evaluate(u, v);
 		diff = T - pt;
 		D = sqrt(diff.dot(diff));
 		
@@ -97,11 +103,12 @@ namespace MN {
 			if (D == 0)
 				return;
 			cnt++;
-			Tu = differentiate(u, v, 1, 0);
-			Tv = differentiate(u, v, 0, 1);
-			Tuu = differentiate(u, v, 2, 0);
-			Tuv = differentiate(u, v, 1, 1);
-			Tvv = differentiate(u, v, 0, 2);
+			SurfaceJet J = torus.jet(u, v);
+			Tu = J.Su;
+			Tv = J.Sv;
+			Tuu = J.Suu;
+			Tuv = J.Suv;
+			Tvv = J.Svv;
 
 			du = Tu.dot(diff) / D;
 			dv = Tv.dot(diff) / D;
@@ -136,7 +143,7 @@ namespace MN {
 					v = piDomain::regularize(v);
 
 					// Test KKT result
-					T = evaluate(u, v);
+					T = torus.evaluate(u, v);
 					diff = T - pt;
 					Real tmpD = diff.len();
 					if (tmpD <= D) {
@@ -166,7 +173,7 @@ namespace MN {
 				u = piDomain::regularize(u);
 				v = piDomain::regularize(v);
 
-				T = evaluate(u, v);
+				T = torus.evaluate(u, v);
 				diff = T - pt;
 				Real tmpD = sqrt(diff.dot(diff));
 				if (tmpD <= D) {
@@ -179,7 +186,8 @@ namespace MN {
 			}
 		}
 	}
-	void TorusPatch::minDistParamRefine(const Vec3& pt, Real& u, Real& v) const {
+	// Refine closest point on patch of [ torus ] in [ uDomain, vDomain ] to [ pt ], shared by [ TorusPatch ] and [ StaticTorusPatch ]
+	static void patchMinDistParamRefine(const TorusShape& torus, const piDomain& uDomain, const piDomain& vDomain, const Vec3& pt, Real& u, Real& v) {
 		// Use KKT condition & Simple gradient descent
 		const static Real eps = 1e-11;
 		Vec3 T, Tu, Tv, Tuu, Tuv, Tvv, diff;
@@ -188,7 +196,7 @@ namespace MN {
 		u = piDomain::regularize(u);
 		v = piDomain::regularize(v);
 
-		T = evaluate(u, v);
+		T = torus.evaluate(u, v);
 		diff = T - pt;
 		D = sqrt(diff.dot(diff));
 
@@ -199,11 +207,12 @@ namespace MN {
 			if (D == 0)
 				return;
 			cnt++;
-			Tu = differentiate(u, v, 1, 0);
-			Tv = differentiate(u, v, 0, 1);
-			Tuu = differentiate(u, v, 2, 0);
-			Tuv = differentiate(u, v, 1, 1);
-			Tvv = differentiate(u, v, 0, 2);
+			SurfaceJet J = torus.jet(u, v);
+			Tu = J.Su;
+			Tv = J.Sv;
+			Tuu = J.Suu;
+			Tuv = J.Suv;
+			Tvv = J.Svv;
 
 			du = Tu.dot(diff) / D;
 			dv = Tv.dot(diff) / D;
@@ -292,7 +301,7 @@ namespace MN {
 								u = piDomain::regularize(uDomain.beg());
 						}
 
-						T = evaluate(u, v);
+						T = torus.evaluate(u, v);
 						diff = T - pt;
 						Real tmpD = sqrt(diff.dot(diff));
 						if (tmpD <= D) {
@@ -328,7 +337,7 @@ namespace MN {
 								v = piDomain::regularize(vDomain.beg());
 						}
 
-						T = evaluate(u, v);
+						T = torus.evaluate(u, v);
 						diff = T - pt;
 						Real tmpD = sqrt(diff.dot(diff));
 						if (tmpD <= D) {
@@ -388,7 +397,7 @@ namespace MN {
 						}
 
 						// Test KKT result
-						T = evaluate(u, v);
+						T = torus.evaluate(u, v);
 						diff = T - pt;
 						Real tmpD = diff.len();
 						if (tmpD <= D) {
@@ -435,7 +444,7 @@ namespace MN {
 						v = piDomain::regularize(vDomain.beg());
 				}
 
-				T = evaluate(u, v);
+				T = torus.evaluate(u, v);
 				diff = T - pt;
 				Real tmpD = sqrt(diff.dot(diff));
 				if (tmpD <= D) {
@@ -448,4 +457,127 @@ namespace MN {
 			}
 		}
 	}
+	void Torus::minDistParamRefine(const Vec3& pt, Real& u, Real& v) const {
+		torusMinDistParamRefine(*this, pt, u, v);
+	}
+	void StaticTorus::minDistParamRefine(const Vec3& pt, Real& u, Real& v) const {
+		torusMinDistParamRefine(*this, pt, u, v);
+	}
+	void TorusPatch::minDistParamRefine(const Vec3& pt, Real& u, Real& v) const {
+		patchMinDistParamRefine(*this, uDomain, vDomain, pt, u, v);
+	}
+	void StaticTorusPatch::minDistParamRefine(const Vec3& pt, Real& u, Real& v) const {
+		patchMinDistParamRefine(*this, uDomain, vDomain, pt, u, v);
+	}
+
+	// Boundary
+	// Squared distance to T(u, v) is [ |pt|^2 + t^2 - 2 * t * rho * cos(u - u0) + ( terms of v ) ], where [ t = R + r * cos(v) ],
+	// [ rho ] is distance from the axis and [ u0 ] is the direction of [ pt ]
+	// If [ t > 0 ], the closest [ u ] in [ uDomain ] is the closest one to [ u0 ] for every [ v ], which is the closest point on major arc,
+	// and then [ v ] is the closest point on minor arc there, so that the closest point is found without refinement
+	// If [ t < 0 ] ( only when [ R < r ] ), the closest [ u ] is the farthest one from [ u0 ], so both are examined
+	static int patchMinDistParamBoundary(const TorusShape& torus, const piDomain& uDomain, const piDomain& vDomain, const Vec3& pt, Real& u, Real& v) {
+		CircularArc major, minor;
+		major.radius = torus.majorRadius;
+		major.domain = uDomain;
+		minor.radius = torus.minorRadius;
+		minor.domain = vDomain;
+
+		int uresult = major.findMinDistParam(pt, u);
+		int vresult = minor.findMinDistParam(torus.uTransform(u).apply(pt), v);
+		int result = (uresult == 0) ? ((vresult == 0) ? 0 : 1) : ((vresult == 0) ? 2 : 3);
+		if (torus.majorRadius >= torus.minorRadius || uresult == 0)
+			return result;
+
+		Real fu, fv;
+		major.findMaxDistParam(pt, fu);
+		fu = piDomain::regularize(fu);
+		int fvresult = minor.findMinDistParam(torus.uTransform(fu).apply(pt), fv);
+		if (pt.distsq(torus.evaluate(fu, fv)) < pt.distsq(torus.evaluate(u, v))) {
+			// [ pt ] is not on the axis here, so only [ v ] could be not unique
+			u = fu;
+			v = fv;
+			result = (fvresult == 0) ? 2 : 3;
+		}
+		return result;
+	}
+	int TorusPatch::findMinDistParamBoundary(const Vec3& pt, Real& u, Real& v) const {
+		return patchMinDistParamBoundary(*this, uDomain, vDomain, pt, u, v);
+	}
+	int StaticTorusPatch::findMinDistParamBoundary(const Vec3& pt, Real& u, Real& v) const {
+		return patchMinDistParamBoundary(*this, uDomain, vDomain, pt, u, v);
+	}
+
+	// Batch
+	// Find closest points on [ patch ] for points in [ beg, end ), run by each thread of [ TorusPatch::findMinDistParams ]
+	static void patchMinDistParams(const StaticTorusPatch& patch, int beg, int end, const Real x[], const Real y[], const Real z[], Real u[], Real v[], Real cx[], Real cy[], Real cz[]) {
+		const CircularArc
+			major = patch.majorCircularArc(),
+			minor = patch.minorCircularArc();
+		const Real
+			R = patch.majorRadius,
+			r = patch.minorRadius,
+			invR = 1.0 / R;
+		Real
+			cu[BATCH_BLOCK], su[BATCH_BLOCK],		// cos(u), sin(u)
+			cv[BATCH_BLOCK], sv[BATCH_BLOCK],		// r * cos(v), r * sin(v)
+			rho[BATCH_BLOCK];
+		for (int b = beg; b < end; b += BATCH_BLOCK) {
+			int n = std::min(BATCH_BLOCK, end - b);
+			const Real *bx = x + b, *by = y + b, *bz = z + b;
+			Real *bu = u + b, *bv = v + b;
+
+			// 1. Major arc, and coordinates in the plane of minor arc at [ u ] ( see [ uTransform ] )
+			// Closest points on arcs give sine and cosine of parameters without library calls
+			major.findMinDistParams(n, bx, by, bu, cu, su);
+			for (int i = 0; i < n; i++) {
+				cu[i] *= invR;
+				su[i] *= invR;
+				rho[i] = bx[i] * cu[i] + by[i] * su[i] - R;
+			}
+
+			// 2. Minor arc
+			minor.findMinDistParams(n, rho, bz, bv, cv, sv);
+
+			// 3. Clamped [ u ] and [ v ] are the closest point ( see [ TorusPatch::findMinDistParamBoundary ] ),
+			// unless [ R < r ], where the other side of major arc is also examined
+			if (R < r) {
+				for (int i = 0; i < n; i++) {
+					patch.findMinDistParamBoundary({ bx[i], by[i], bz[i] }, bu[i], bv[i]);
+					cu[i] = cos(bu[i]);
+					su[i] = sin(bu[i]);
+					cv[i] = r * cos(bv[i]);
+					sv[i] = r * sin(bv[i]);
+				}
+			}
+
+			if (cx == nullptr || cy == nullptr || cz == nullptr)
+				continue;
+			for (int i = 0; i < n; i++) {
+				Real t = R + cv[i];
+				cx[b + i] = t * cu[i];
+				cy[b + i] = t * su[i];
+				cz[b + i] = sv[i];
+			}
+		}
+	}
+	void TorusPatch::findMinDistParams(int num, const Real x[], const Real y[], const Real z[], Real u[], Real v[], Real cx[], Real cy[], Real cz[], int threadNum) const {
+		StaticTorusPatch patch = StaticTorusPatch::create(*this);
+		if (threadNum <= 0)
+			threadNum = (int)std::thread::hardware_concurrency();
+		threadNum = std::min(threadNum, num / BATCH_THREAD);
+		if (threadNum <= 1) {
+			patchMinDistParams(patch, 0, num, x, y, z, u, v, cx, cy, cz);
+			return;
+		}
+
+		// Chunks are aligned to [ BATCH_BLOCK ], so that threads do not share cache lines of outputs
+		int chunk = (num / threadNum + BATCH_BLOCK - 1) / BATCH_BLOCK * BATCH_BLOCK;
+		std::vector<std::thread> threads;
+		for (int beg = chunk; beg < num; beg += chunk)
+			threads.emplace_back(patchMinDistParams, std::cref(patch), beg, std::min(beg + chunk, num), x, y, z, u, v, cx, cy, cz);
+		patchMinDistParams(patch, 0, std::min(chunk, num), x, y, z, u, v, cx, cy, cz);
+		for (auto& thread : threads)
+			thread.join();
+	}
 }
\ No newline at end of file
@@ -14,10 +14,12 @@
 #endif
 
 #include "../Circle/Circle.h"
+#include "../SurfaceJet.h"
 #include "Minute/Freeform/Biarc2d.h"
 
 namespace MN {
-	class Torus {
+	// Geometry of torus without any virtual function, shared by [ Torus ] and static torus primitives ( [ StaticTorus ] )
+	class TorusShape {
 	public:
 		Real majorRadius;
 		Real minorRadius;
@@ -75,11 +77,33 @@ namespace MN {
 			else if (uOrder == 0 && vOrder == 3)
 			{
 				tmp = minorRadius * sin(v);
-				return { tmp * cos(u),tmp * sin(u), tmp };
+				return { tmp * cos(u),tmp * sin(u), -minorRadius * cos(v) };
 			}
 			else
 				throw(std::runtime_error("Invalid torus differentiation order"));
 		}
+		// Position and all partial derivatives up to 3rd order, sharing one pair of sine and cosine for each parameter
+		// Use it instead of [ differentiate ] when several orders are needed at the same ( u, v )
+		inline SurfaceJet jet(Real u, Real v) const noexcept {
+			Real
+				cu = cos(u), su = sin(u),
+				cv = cos(v), sv = sin(v),
+				t = majorRadius + minorRadius * cv,
+				rc = minorRadius * cv,
+				rs = minorRadius * sv;
+			SurfaceJet J;
+			J.S = { t * cu, t * su, rs };
+			J.Su = { -t * su, t * cu, 0.0 };
+			J.Sv = { -rs * cu, -rs * su, rc };
+			J.Suu = { -t * cu, -t * su, 0.0 };
+			J.Suv = { rs * su, -rs * cu, 0.0 };
+			J.Svv = { -rc * cu, -rc * su, -rs };
+			J.Suuu = { t * su, -t * cu, 0.0 };
+			J.Suuv = { rs * cu, rs * su, 0.0 };
+			J.Suvv = { rc * su, -rc * cu, 0.0 };
+			J.Svvv = { rs * cu, rs * su, -rc };
+			return J;
+		}
 		inline Vec3 normal(Real u, Real v) const {
 			Vec3
 				Su = differentiate(u, v, 1, 0),
@@ -88,6 +112,11 @@ namespace MN {
 			N.normalize();
 			return N;
 		}
+		// Signed distance from [ pt ] to the full torus ( negative inside ), which is a lower bound of distance to any patch of it
+		inline Real signedDistance(const Vec3& pt) const {
+			Real rho = sqrt(SQ(pt[0]) + SQ(pt[1])) - majorRadius;
+			return sqrt(SQ(rho) + SQ(pt[2])) - minorRadius;
+		}
 
 		// For given u, give transform that takes torus coordinates to local coordiantes of [ u ] circular arc
 		inline Transform uTransform(Real u) const {
@@ -118,9 +147,10 @@ namespace MN {
 			mc.radius = minorRadius;
 			return mc;
 		}
+	};
 
-
-		
+	class Torus : public TorusShape {
+	public:
 		/* Parameter */
 		// Find parameter [ u0 ] such that [ MC(u0) ] is the closest point on major circle [ MC(u) ] to the given point [ pt ]
 		// @return : 
@@ -563,6 +593,202 @@ namespace MN {
 			maxfpt = evaluate(maxp.first, maxp.second);
 			return result;
 		}
+
+		// Same as [ findMinDistParam ], but exact and without numerical refinement, even if the closest point is on the boundary
+		// For every [ v ], the closest [ u ] in [ uDomain ] is the closest point on major arc ( if R >= r ),
+		// so the closest point on minor arc there is the answer ( see [ patchMinDistParamBoundary ] in Torus.cpp )
+		// @return : Same as [ findMinDistParam ]
+		int findMinDistParamBoundary(const Vec3& pt, Real& u, Real& v) const;
+
+		// Batch version of [ findMinDistParam ] and [ findMinDistPoint ] for [ num ] points given in structure of arrays ( local coordinates )
+		// Projections onto major and minor arcs are done in blocks by [ CircularArc::findMinDistParams ], which vectorize
+		// Clamping to domain is done by selects in those projections, which gives exact closest point ( see [ findMinDistParamBoundary ] )
+		// @cx, cy, cz :	Closest points, not computed if nullptr
+		// @threadNum :		Number of threads to split points, [ std::thread::hardware_concurrency() ] if not positive
+		//					Small batches are not split, since thread creation costs more
+		void findMinDistParams(int num, const Real x[], const Real y[], const Real z[], Real u[], Real v[],
+			Real cx[] = nullptr, Real cy[] = nullptr, Real cz[] = nullptr, int threadNum = 0) const;
+	};
+
+	/*
+	 * Static ( non-virtual ) torus primitives
+	 *  [ TorusQuery ] builds queries on the surface from parameter queries on major ( U ) and minor ( V ) circles of [ Derived ] by CRTP,
+	 *  so that every call is resolved at compile time and can be inlined in hot loops. Primitives do not have virtual table pointer,
+	 *  so they can be packed in arrays. Their semantics are same as [ Torus ] and [ TorusPatch ].
+	 *  Projections are not faster than virtual ones, since they are dominated by arc projections ( see Benchmark/TorusPatchBenchmark.cpp ).
+	 *  [ Derived ] has to provide [ evaluate ], [ find( Min | Max | Ext )DistParam( U | V ) ] and [ minDistParamRefine ].
+	 */
+	template<typename Derived>
+	class TorusQuery {
+	public:
+		/* Parameter */
+		// See [ Torus::findMinDistParam ]
+		inline int findMinDistParam(const Vec3& pt, Real& u, Real& v) const {
+			int uresult, vresult;
+			uresult = derived().findMinDistParamU(pt, u);
+			vresult = derived().findMinDistParamV(pt, u, v);
+			derived().minDistParamRefine(pt, u, v);
+			if (uresult == 0)
+				return (vresult == 0) ? 0 : 1;
+			return (vresult == 0) ? 2 : 3;
+		}
+		// See [ Torus::findMaxDistParam ]
+		inline int findMaxDistParam(const Vec3& pt, Real& u, Real& v) const {
+			int uresult, vresult;
+			uresult = derived().findMaxDistParamU(pt, u);
+			vresult = derived().findMaxDistParamV(pt, u, v);
+			if (uresult == 0)
+				return (vresult == 0) ? 0 : 1;
+			return (vresult == 0) ? 2 : 3;
+		}
+		// See [ Torus::findExtDistParam ]
+		inline int findExtDistParam(const Vec3& pt, Real2& minParam, Real2& maxParam) const {
+			int uresult, vresult0, vresult1;
+			uresult = derived().findExtDistParamU(pt, minParam.first, maxParam.first);
+			if (uresult == 0) {
+				derived().findExtDistParamV(pt, minParam.first, minParam.second, maxParam.second);
+				return 0;
+			}
+			else {
+				vresult0 = derived().findMinDistParamV(pt, minParam.first, minParam.second);
+				derived().minDistParamRefine(pt, minParam.first, minParam.second);
+				vresult1 = derived().findMaxDistParamV(pt, maxParam.first, maxParam.second);
+				if (vresult0 == 0 && vresult1 == 0)
+					throw("It should not happen");
+				else if (vresult0 == 0)
+					return 1;
+				else if (vresult1 == 0)
+					return 2;
+				else
+					return 3;
+			}
+		}
+
+		/* Point */
+		// See [ Torus::findMinDistPoint ]
+		inline int findMinDistPoint(const Vec3& pt, Vec3& fpt) const {
+			Real u, v;
+			int result = findMinDistParam(pt, u, v);
+			fpt = derived().evaluate(u, v);
+			return (result == 3);
+		}
+		// See [ Torus::findMaxDistPoint ]
+		inline int findMaxDistPoint(const Vec3& pt, Vec3& fpt) const {
+			Real u, v;
+			int result = findMaxDistParam(pt, u, v);
+			fpt = derived().evaluate(u, v);
+			return (result == 3);
+		}
+		// See [ Torus::findExtDistPoint ]
+		inline int findExtDistPoint(const Vec3& pt, Vec3& minfpt, Vec3& maxfpt) const {
+			Real2 minp, maxp;
+			int result = findExtDistParam(pt, minp, maxp);
+			minfpt = derived().evaluate(minp.first, minp.second);
+			maxfpt = derived().evaluate(maxp.first, maxp.second);
+			return result;
+		}
+	private:
+		inline const Derived& derived() const noexcept {
+			return static_cast<const Derived&>(*this);
+		}
+	};
+
+	// Static version of [ Torus ]
+	class StaticTorus : public TorusShape, public TorusQuery<StaticTorus> {
+	public:
+		static inline StaticTorus create(const TorusShape& torus) noexcept {
+			StaticTorus st;
+			st.majorRadius = torus.majorRadius;
+			st.minorRadius = torus.minorRadius;
+			return st;
+		}
+
+		/* Parameter */
+		// See [ Torus::findMinDistParamU ]
+		inline int findMinDistParamU(const Vec3& pt, Real& u) const {
+			return majorCircle().Circle::findMinDistParam(pt, u);
+		}
+		// See [ Torus::findMaxDistParamU ]
+		inline int findMaxDistParamU(const Vec3& pt, Real& u) const {
+			return majorCircle().Circle::findMaxDistParam(pt, u);
+		}
+		// See [ Torus::findExtDistParamU ]
+		inline int findExtDistParamU(const Vec3& pt, Real& minU, Real& maxU) const {
+			return majorCircle().Circle::findExtDistParam(pt, minU, maxU);
+		}
+		// See [ Torus::findMinDistParamV ]
+		inline int findMinDistParamV(const Vec3& pt, Real u, Real& v) const {
+			return minorCircle().Circle::findMinDistParam(uTransform(u).apply(pt), v);
+		}
+		// See [ Torus::findMaxDistParamV ]
+		inline int findMaxDistParamV(const Vec3& pt, Real u, Real& v) const {
+			return minorCircle().Circle::findMaxDistParam(uTransform(u).apply(pt), v);
+		}
+		// See [ Torus::findExtDistParamV ]
+		inline int findExtDistParamV(const Vec3& pt, Real u, Real& minV, Real& maxV) const {
+			return minorCircle().Circle::findExtDistParam(uTransform(u).apply(pt), minV, maxV);
+		}
+		// See [ Torus::minDistParamRefine ]
+		void minDistParamRefine(const Vec3& pt, Real& u, Real& v) const;
+	};
+
+	// Static version of [ TorusPatch ]
+	class StaticTorusPatch : public TorusShape, public TorusQuery<StaticTorusPatch> {
+	public:
+		piDomain uDomain;
+		piDomain vDomain;
+
+		static inline StaticTorusPatch create(const TorusPatch& patch) noexcept {
+			StaticTorusPatch sp;
+			sp.majorRadius = patch.majorRadius;
+			sp.minorRadius = patch.minorRadius;
+			sp.uDomain = patch.uDomain;
+			sp.vDomain = patch.vDomain;
+			return sp;
+		}
+
+		inline CircularArc majorCircularArc() const noexcept {
+			CircularArc mc;
+			mc.radius = majorRadius;
+			mc.domain = uDomain;
+			return mc;
+		}
+		inline CircularArc minorCircularArc() const noexcept {
+			CircularArc mc;
+			mc.radius = minorRadius;
+			mc.domain = vDomain;
+			return mc;
+		}
+
+		/* Parameter */
+		// See [ TorusPatch::findMinDistParamU ]
+		inline int findMinDistParamU(const Vec3& pt, Real& u) const {
+			return majorCircularArc().CircularArc::findMinDistParam(pt, u);
+		}
+		// See [ TorusPatch::findMaxDistParamU ]
+		inline int findMaxDistParamU(const Vec3& pt, Real& u) const {
+			return majorCircularArc().CircularArc::findMaxDistParam(pt, u);
+		}
+		// See [ TorusPatch::findExtDistParamU ]
+		inline int findExtDistParamU(const Vec3& pt, Real& minU, Real& maxU) const {
+			return majorCircularArc().CircularArc::findExtDistParam(pt, minU, maxU);
+		}
+		// See [ TorusPatch::findMinDistParamV ]
+		inline int findMinDistParamV(const Vec3& pt, Real u, Real& v) const {
+			return minorCircularArc().CircularArc::findMinDistParam(uTransform(u).apply(pt), v);
+		}
+		// See [ TorusPatch::findMaxDistParamV ]
+		inline int findMaxDistParamV(const Vec3& pt, Real u, Real& v) const {
+			return minorCircularArc().CircularArc::findMaxDistParam(uTransform(u).apply(pt), v);
+		}
+		// See [ TorusPatch::findExtDistParamV ]
+		inline int findExtDistParamV(const Vec3& pt, Real u, Real& minV, Real& maxV) const {
+			return minorCircularArc().CircularArc::findExtDistParam(uTransform(u).apply(pt), minV, maxV);
+		}
+		// See [ TorusPatch::minDistParamRefine ]
+		void minDistParamRefine(const Vec3& pt, Real& u, Real& v) const;
+		// See [ TorusPatch::findMinDistParamBoundary ]
+		int findMinDistParamBoundary(const Vec3& pt, Real& u, Real& v) const;
 	};
 }
 
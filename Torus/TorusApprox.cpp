@@ -29,11 +29,12 @@ namespace MN {
 		Fu = surface.Fu;
 		Fv = surface.Fv;
 
-		Gmm = torus.transform.applyR(torus.patch.differentiate(m, n, 2, 0));
-		Gmn = torus.transform.applyR(torus.patch.differentiate(m, n, 1, 1));
-		Gnn = torus.transform.applyR(torus.patch.differentiate(m, n, 0, 2));
-		Gm = torus.transform.applyR(torus.patch.differentiate(m, n, 1, 0));
-		Gn = torus.transform.applyR(torus.patch.differentiate(m, n, 0, 1));
+		SurfaceJet J = torus.patch.jet(m, n);
+		Gmm = torus.transform.applyR(J.Suu);
+		Gmn = torus.transform.applyR(J.Suv);
+		Gnn = torus.transform.applyR(J.Svv);
+		Gm = torus.transform.applyR(J.Su);
+		Gn = torus.transform.applyR(J.Sv);
 
 		// M, N Coefs
 		{
@@ -13,7 +13,18 @@
 #define PROXIMITY_EPS	1e-10
 #define SAME_ANGLE_EPS	(1-1e-10)	// If dot product between two vectors exceed this value, they are considered as same vectors 
 
+#ifdef MN_BINORMAL_STATS
+#define TORUS_BINORMAL_STATS(counter)	(TorusBinormal::stats().counter++)
+#else
+#define TORUS_BINORMAL_STATS(counter)	((void)0)
+#endif
+
 namespace MN {
+	TorusBinormal::Stats& TorusBinormal::stats() noexcept {
+		thread_local Stats threadStats;
+		return threadStats;
+	}
+
 	// Full torus
 	void TorusBinormal::solve(const Torus& a, const Torus& b, const Transform& ta, const Transform& tb, std::vector<Binormal>& bins) {
 		Transform atob, btoa;
@@ -36,8 +47,30 @@ namespace MN {
 		fSolve(ta, tb, atob, btoa, bins);
 	}
 
+	void TorusBinormal::solve(const Torus& a, const Torus& b, const Transform& ta, const Transform& tb, CircleBinormal::Tracker& tracker, std::vector<Binormal>& bins) {
+		Transform atob, btoa;
+		atob = Transform::connect(ta, tb);
+		btoa = Transform::connect(tb, ta);
+		fSolve(a, b, atob, btoa, tracker, bins);
+	}
+	void TorusBinormal::fSolve(const Torus& a, const Torus& b, const Transform& atob, const Transform& btoa, CircleBinormal::Tracker& tracker, std::vector<Binormal>& bins) {
+		TorusPatch ta, tb;
+		ta.majorRadius = a.majorRadius;
+		ta.minorRadius = a.minorRadius;
+		ta.uDomain.set(0, PI20);
+		ta.vDomain.set(0, PI20);
+
+		tb.majorRadius = b.majorRadius;
+		tb.minorRadius = b.minorRadius;
+		tb.uDomain.set(0, PI20);
+		tb.vDomain.set(0, PI20);
+
+		fSolve(ta, tb, atob, btoa, tracker, bins);
+	}
+
 	// Torus patch
-	static void exceptionSameMajorCircle(const TorusPatch& a, const TorusPatch& b, const Transform& atob, const Transform& btoa, std::vector<TorusBinormal::Binormal>& bins) {
+	static void exceptionSameMajorCircle(const StaticTorusPatch& a, const StaticTorusPatch& b, const Transform& atob, const Transform& btoa, std::vector<TorusBinormal::Binormal>& bins) {
+		TORUS_BINORMAL_STATS(sameMajorCircleNum);
 		bins.reserve(6);
 
 		//Vec3 apt, aptB;
@@ -249,7 +282,8 @@ namespace MN {
 			}
 		}
 	}
-	static void exceptionAlignMajorCircle(const TorusPatch& a, const TorusPatch& b, const Transform& atob, const Transform& btoa, std::vector<TorusBinormal::Binormal>& bins) {
+	static void exceptionAlignMajorCircle(const StaticTorusPatch& a, const StaticTorusPatch& b, const Transform& atob, const Transform& btoa, std::vector<TorusBinormal::Binormal>& bins) {
+		TORUS_BINORMAL_STATS(alignMajorCircleNum);
 		bins.reserve(8);
 
 		TorusBinormal::Binormal bin;
@@ -337,7 +371,8 @@ namespace MN {
 			}
 		}
 	}
-	static void exceptionSameMinorCircleCenter(const TorusPatch& a, const TorusPatch& b, const Transform& atob, const Transform& btoa, Real uA, Real uB, std::vector<TorusBinormal::Binormal>& bins) {
+	static void exceptionSameMinorCircleCenter(const StaticTorusPatch& a, const StaticTorusPatch& b, const Transform& atob, const Transform& btoa, Real uA, Real uB, std::vector<TorusBinormal::Binormal>& bins) {
+		TORUS_BINORMAL_STATS(sameMinorCircleCenterNum);
 		TorusBinormal::Binormal bin;
 		Vec3 apt, bpt, aptB, bptA;
 		
@@ -461,7 +496,8 @@ namespace MN {
 			}
 		}
 	}
-	static void exceptionAmajorBminorCircleAlign(const TorusPatch& a, const TorusPatch& b, const Transform& atob, const Transform& btoa, Real uA, Real uB, std::vector<TorusBinormal::Binormal>& bins) {
+	static void exceptionAmajorBminorCircleAlign(const StaticTorusPatch& a, const StaticTorusPatch& b, const Transform& atob, const Transform& btoa, Real uA, Real uB, std::vector<TorusBinormal::Binormal>& bins) {
+		TORUS_BINORMAL_STATS(circleAlignNum);
 		//Vec3 apt, aptB;
 		Vec3 bpt, bptA;
 		TorusBinormal::Binormal bin;
@@ -540,7 +576,8 @@ namespace MN {
 			}
 		}
 	}
-	static void exceptionAminorBmajorCircleAlign(const TorusPatch& a, const TorusPatch& b, const Transform& atob, const Transform& btoa, Real uA, Real uB, std::vector<TorusBinormal::Binormal>& bins) {
+	static void exceptionAminorBmajorCircleAlign(const StaticTorusPatch& a, const StaticTorusPatch& b, const Transform& atob, const Transform& btoa, Real uA, Real uB, std::vector<TorusBinormal::Binormal>& bins) {
+		TORUS_BINORMAL_STATS(circleAlignNum);
 		//Vec3 bpt, bptA;
 		Vec3 apt, aptB;
 		TorusBinormal::Binormal bin;
@@ -625,15 +662,9 @@ namespace MN {
 		btoa = Transform::connect(tb, ta);
 		fSolve(a, b, atob, btoa, bins);
 	}
-	void TorusBinormal::fSolve(const TorusPatch& a, const TorusPatch& b, const Transform& atob, const Transform& btoa, std::vector<Binormal>& bins) {
-		Vec3 apt, bpt, aptB, bptA;
-		CircularArc arcA, arcB;
-		arcA = a.majorCircularArc();
-		arcB = b.majorCircularArc();
-		Binormal bin;
-
-		bins.clear();
-		// Exception 1 : Same center ( on XY plane ), Same axis
+	// Exception 1 : Same center ( on XY plane ), Same axis
+	// @ret : True if [ a ] and [ b ] are in this configuration, and binormals are found in [ bins ]
+	static bool exceptionMajorCircle(const StaticTorusPatch& a, const StaticTorusPatch& b, const Transform& atob, const Transform& btoa, std::vector<TorusBinormal::Binormal>& bins) {
 		if (fabs(btoa.T[0]) < PROXIMITY_EPS && fabs(btoa.T[1]) < PROXIMITY_EPS) {
 			// [ b ]'s center is on the axis of [ a ]
 			if (fabs(btoa.R[2][2]) > 1 - PROXIMITY_EPS) {
@@ -644,13 +675,16 @@ namespace MN {
 				else 
 					// [ b ]'s major circle is aligned with that of [ a ]
 					exceptionAlignMajorCircle(a, b, atob, btoa, bins);
-				return;
+				return true;
 			}
 		}
+		return false;
+	}
+	// Find torus binormals from binormals of major circles [ mcbins ]
+	static void majorCircleBinormals(const StaticTorusPatch& a, const StaticTorusPatch& b, const Transform& atob, const Transform& btoa, const std::vector<CircleBinormal::Binormal>& mcbins, std::vector<TorusBinormal::Binormal>& bins) {
+		Vec3 apt, bpt, aptB, bptA;
+		TorusBinormal::Binormal bin;
 
-		std::vector<CircleBinormal::Binormal> mcbins;	// Major circle binormals
-		circleBinormal.solve(arcA, arcB, btoa, mcbins);
-		
 		bins.clear();
 		bins.reserve(mcbins.size() * 4);
 
@@ -703,6 +737,34 @@ namespace MN {
 			}
 		}
 	}
+	void TorusBinormal::fSolve(const TorusPatch& a, const TorusPatch& b, const Transform& atob, const Transform& btoa, std::vector<Binormal>& bins) {
+		bins.clear();
+		StaticTorusPatch sa = StaticTorusPatch::create(a), sb = StaticTorusPatch::create(b);
+		if (exceptionMajorCircle(sa, sb, atob, btoa, bins))
+			return;
+
+		std::vector<CircleBinormal::Binormal> mcbins;	// Major circle binormals
+		circleBinormal.solve(a.majorCircularArc(), b.majorCircularArc(), btoa, mcbins);
+		majorCircleBinormals(sa, sb, atob, btoa, mcbins, bins);
+	}
+	void TorusBinormal::solve(const TorusPatch& a, const TorusPatch& b, const Transform& ta, const Transform& tb, CircleBinormal::Tracker& tracker, std::vector<Binormal>& bins) {
+		Transform atob, btoa;
+		atob = Transform::connect(ta, tb);
+		btoa = Transform::connect(tb, ta);
+		fSolve(a, b, atob, btoa, tracker, bins);
+	}
+	void TorusBinormal::fSolve(const TorusPatch& a, const TorusPatch& b, const Transform& atob, const Transform& btoa, CircleBinormal::Tracker& tracker, std::vector<Binormal>& bins) {
+		bins.clear();
+		StaticTorusPatch sa = StaticTorusPatch::create(a), sb = StaticTorusPatch::create(b);
+		if (exceptionMajorCircle(sa, sb, atob, btoa, bins)) {
+			tracker.reset();
+			return;
+		}
+
+		std::vector<CircleBinormal::Binormal> mcbins;	// Major circle binormals
+		circleBinormal.track(a.majorCircularArc(), b.majorCircularArc(), btoa, tracker, mcbins);
+		majorCircleBinormals(sa, sb, atob, btoa, mcbins, bins);
+	}
 
 	// Torus patch with gaussmap
 	void TorusBinormal::solve(const TPatchGmap& a, const TPatchGmap& b, const Transform& ta, const Transform& tb, bool aOutward, bool aInward, bool bOutward, bool bInward, std::vector<Binormal>& bins) {
@@ -712,10 +774,11 @@ namespace MN {
 		fSolve(a, b, atob, btoa, aOutward, aInward, bOutward, bInward, bins);
 	}
 	void TorusBinormal::fSolve(const TPatchGmap& a, const TPatchGmap& b, const Transform& atob, const Transform& btoa, bool aOutward, bool aInward, bool bOutward, bool bInward, std::vector<Binormal>& bins) {
+		StaticTorusPatch pa = StaticTorusPatch::create(a.patch), pb = StaticTorusPatch::create(b.patch);
 		Vec3 apt, bpt, aptB, bptA;
 		CircularArc arcA, arcB;
-		arcA = a.patch.majorCircularArc();
-		arcB = b.patch.majorCircularArc();
+		arcA = pa.majorCircularArc();
+		arcB = pb.majorCircularArc();
 		Binormal bin;
 
 		bins.clear();
@@ -724,12 +787,12 @@ namespace MN {
 			// [ b ]'s center is on the axis of [ a ]
 			if (fabs(btoa.R[2][2]) > 1 - PROXIMITY_EPS) {
 				// [ b ]'s axis is parallel to that of [ a ]
-				if (a.patch.majorRadius == b.patch.majorRadius && fabs(btoa.T[2]) < PROXIMITY_EPS)
+				if (pa.majorRadius == pb.majorRadius && fabs(btoa.T[2]) < PROXIMITY_EPS)
 					// [ b ]'s major circle is same with that of [ a ]
-					exceptionSameMajorCircle(a.patch, b.patch, atob, btoa, bins);
+					exceptionSameMajorCircle(pa, pb, atob, btoa, bins);
 				else
 					// [ b ]'s major circle is aligned with that of [ a ]
-					exceptionAlignMajorCircle(a.patch, b.patch, atob, btoa, bins);
+					exceptionAlignMajorCircle(pa, pb, atob, btoa, bins);
 				return;
 			}
 		}
@@ -819,24 +882,24 @@ namespace MN {
 
 			// Exception 2 : Minor circle's centers coincide
 			if (apt.dist(bptA) < PROXIMITY_EPS) {
-				exceptionSameMinorCircleCenter(a.patch, b.patch, atob, btoa, mcbin.paramA, mcbin.paramB, bins);
+				exceptionSameMinorCircleCenter(pa, pb, atob, btoa, mcbin.paramA, mcbin.paramB, bins);
 				continue;
 			}
 
 			// Exception 3 : mcbin's type is 2 or 3 ( cannot be type 1, because such cases are dealt with in Exception 1 )
 			if (mcbin.type != 0) {
 				if (mcbin.type == 2)
-					exceptionAmajorBminorCircleAlign(a.patch, b.patch, atob, btoa, mcbin.paramA, mcbin.paramB, bins);
+					exceptionAmajorBminorCircleAlign(pa, pb, atob, btoa, mcbin.paramA, mcbin.paramB, bins);
 				else if (mcbin.type == 3)
-					exceptionAminorBmajorCircleAlign(a.patch, b.patch, atob, btoa, mcbin.paramA, mcbin.paramB, bins);
+					exceptionAminorBmajorCircleAlign(pa, pb, atob, btoa, mcbin.paramA, mcbin.paramB, bins);
 				continue;
 			}
 
 			// Normal Case
 			Real vA[2], vB[2];
 			bool validA[2], validB[2];
-			int ares = a.patch.findExtDistParamV(bptA, mcbin.paramA, vA[0], vA[1]);
-			int bres = b.patch.findExtDistParamV(aptB, mcbin.paramB, vB[0], vB[1]);
+			int ares = pa.findExtDistParamV(bptA, mcbin.paramA, vA[0], vA[1]);
+			int bres = pb.findExtDistParamV(aptB, mcbin.paramB, vB[0], vB[1]);
 			validA[0] = (ares == 3 || ares == 4);
 			validA[1] = (ares == 2 || ares == 4);
 			validB[0] = (bres == 3 || bres == 4);
@@ -851,8 +914,8 @@ namespace MN {
 					if (validA[i] && validB[j]) {
 						bin.vA = vA[i];
 						bin.vB = vB[j];
-						bin.pointA = a.patch.evaluate(bin.uA, bin.vA);
-						bin.pointB = b.patch.evaluate(bin.uB, bin.vB);
+						bin.pointA = pa.evaluate(bin.uA, bin.vA);
+						bin.pointB = pb.evaluate(bin.uB, bin.vB);
 						bin.length = atob.apply(bin.pointA).dist(bin.pointB);
 						bins.push_back(bin);
 					}
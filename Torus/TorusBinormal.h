@@ -37,6 +37,28 @@ namespace MN {
 			//piDomain uDomainB;
 			//piDomain vDomainB;		// These information depends on type
 		};
+		// Counters of special configurations, updated only if [ MN_BINORMAL_STATS ] is defined ( see CircleBinormal::Stats )
+		// Counters of major circle binormal search are found in CircleBinormal::stats()
+		struct Stats {
+			long long	sameMajorCircleNum = 0;			// Exception 1 : Same major circle
+			long long	alignMajorCircleNum = 0;		// Exception 1 : Major circles share axis
+			long long	sameMinorCircleCenterNum = 0;	// Exception 2 : Minor circle's centers coincide
+			long long	circleAlignNum = 0;				// Exception 3 : Major circle of one torus is aligned with minor circle of the other
+
+			inline void reset() noexcept {
+				*this = Stats();
+			}
+			inline Stats& operator+=(const Stats& s) noexcept {
+				sameMajorCircleNum += s.sameMajorCircleNum;
+				alignMajorCircleNum += s.alignMajorCircleNum;
+				sameMinorCircleCenterNum += s.sameMinorCircleCenterNum;
+				circleAlignNum += s.circleAlignNum;
+				return *this;
+			}
+		};
+		// Counters of the calling thread
+		static Stats& stats() noexcept;
+
 		CircleBinormal circleBinormal;
 
 		void solve(const Torus& a, const Torus& b, const Transform& ta, const Transform& tb, std::vector<Binormal>& bins);
@@ -45,6 +67,16 @@ namespace MN {
 		void solve(const TorusPatch& a, const TorusPatch& b, const Transform& ta, const Transform& tb, std::vector<Binormal>& bins);
 		void fSolve(const TorusPatch& a, const TorusPatch& b, const Transform& atob, const Transform& btoa, std::vector<Binormal>& bins);
 
+		/*
+		 * Find torus binormal over consecutive frames of the same pair
+		 *  Binormals of major circles are tracked by [ tracker ] ( see CircleBinormal::track )
+		 */
+		void solve(const Torus& a, const Torus& b, const Transform& ta, const Transform& tb, CircleBinormal::Tracker& tracker, std::vector<Binormal>& bins);
+		void fSolve(const Torus& a, const Torus& b, const Transform& atob, const Transform& btoa, CircleBinormal::Tracker& tracker, std::vector<Binormal>& bins);
+
+		void solve(const TorusPatch& a, const TorusPatch& b, const Transform& ta, const Transform& tb, CircleBinormal::Tracker& tracker, std::vector<Binormal>& bins);
+		void fSolve(const TorusPatch& a, const TorusPatch& b, const Transform& atob, const Transform& btoa, CircleBinormal::Tracker& tracker, std::vector<Binormal>& bins);
+
 		/*
 		 * Find torus binormal with gaussmap information
 		 *  @aOption, bOption : option[0] = Use outward normals, option[1] = Use inward normals
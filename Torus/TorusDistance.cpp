@@ -7,6 +7,11 @@
  */
 
 #include "TorusDistance.h"
+#include "../Circle/CircleDistance.h"
+#include <algorithm>
+
+#define CROSS_ITER		60		// Number of bisection steps to find the point where segment crosses torus
+#define MAX_EXACT_EPS	1e-10	// Relative tolerance to accept maximum distance between patches as exact
 
 namespace MN {
 	Distance TorusDistance::minDistanceLocal(const TorusPatch& a, const TorusPatch& b, const Transform& ta, const Transform& tb, Real2 pa, Real2 pb) {
@@ -23,18 +28,19 @@ namespace MN {
 		Vec3 tmppt, diff;
 		Real mind = maxDouble, curd;
 		int iter = 0;
+		StaticTorusPatch sa = StaticTorusPatch::create(a), sb = StaticTorusPatch::create(b);	// Devirtualized projections
 
-		distance.pointA = a.evaluate(pa.first, pa.second);
+		distance.pointA = sa.evaluate(pa.first, pa.second);
 
 		while (true) {
 			if (projectOnB) {
 				tmppt = atob.apply(distance.pointA);
-				b.findMinDistPoint(tmppt, distance.pointB);
+				sb.findMinDistPoint(tmppt, distance.pointB);
 				diff = tmppt - distance.pointB;
 			}
 			else {
 				tmppt = btoa.apply(distance.pointB);
-				a.findMinDistPoint(tmppt, distance.pointA);
+				sa.findMinDistPoint(tmppt, distance.pointA);
 				diff = tmppt - distance.pointA;
 			}
 			curd = diff.lensq();
@@ -51,4 +57,257 @@ namespace MN {
 		distance.length = sqrt(mind);
 		return distance;
 	}
+	// Max distance
+	// Set ( u, v ) and points of [ distance ] from farthest pair of major circle ( arc ) points, whose [ u ] are in [ paramA[0] ], [ paramB[0] ]
+	// [ v ] is the farthest point on minor circle ( arc ) from the other major circle point
+	// @return : True if both [ v ] are in the inner part of [ vDomain ], so that the pair is farthest
+	template<typename T>
+	inline static bool farMinorCandidate(const T& a, const T& b, const Transform& atob, const Transform& btoa, Distance& distance) {
+		Vec3
+			ca = a.majorCircle().evaluate(distance.paramA[0]),
+			cb = b.majorCircle().evaluate(distance.paramB[0]);
+		int
+			ra = a.findMaxDistParamV(btoa.apply(cb), distance.paramA[0], distance.paramA[1]),
+			rb = b.findMaxDistParamV(atob.apply(ca), distance.paramB[0], distance.paramB[1]);
+		distance.paramA[1] = piDomain::regularize(distance.paramA[1]);
+		distance.paramB[1] = piDomain::regularize(distance.paramB[1]);
+		distance.pointA = a.evaluate(distance.paramA[0], distance.paramA[1]);
+		distance.pointB = b.evaluate(distance.paramB[0], distance.paramB[1]);
+		distance.length = distance.pointA.dist(btoa.apply(distance.pointB));
+		return ra != 0 && rb != 0 && ra != 1 && rb != 1;
+	}
+	Distance TorusDistance::maxDistance(const Torus& a, const Torus& b, const Transform& ta, const Transform& tb) {
+		Transform
+			atob = Transform::connect(ta, tb),
+			btoa = Transform::connect(tb, ta);
+		StaticTorus sa = StaticTorus::create(a), sb = StaticTorus::create(b);
+		Distance distance = MN::maxDistance(sa.majorCircle(), sb.majorCircle(), ta, tb);
+		farMinorCandidate(sa, sb, atob, btoa, distance);
+		return distance;
+	}
+	Distance TorusDistance::maxDistance(const TorusPatch& a, const TorusPatch& b, const Transform& ta, const Transform& tb, bool& exact) {
+		Transform
+			atob = Transform::connect(ta, tb),
+			btoa = Transform::connect(tb, ta);
+		StaticTorusPatch sa = StaticTorusPatch::create(a), sb = StaticTorusPatch::create(b);
+		Distance distance = MN::maxDistance(sa.majorCircularArc(), sb.majorCircularArc(), ta, tb);
+
+		// Every point of a patch is within minor radius from its major arc, so this is an upper bound of the maximum distance
+		// A pair that reaches it is the farthest one
+		const Real bound = (distance.length + a.minorRadius + b.minorRadius) * (1.0 - MAX_EXACT_EPS);
+		exact = farMinorCandidate(sa, sb, atob, btoa, distance) && distance.length >= bound;
+		if (exact)
+			return distance;
+
+		// Farthest pair is on the boundary of a patch, so refine from this pair and from corners of the patches
+		Distance refined = fMaxDistanceLocal(a, b, atob, btoa,
+			{ distance.paramA[0], distance.paramA[1] },
+			{ distance.paramB[0], distance.paramB[1] });
+		if (refined.length > distance.length)
+			distance = refined;
+		for (int i = 0; i < 4; i++) {
+			Real2
+				pa = { (i & 1) ? a.uDomain.end() : a.uDomain.beg(), (i & 2) ? a.vDomain.end() : a.vDomain.beg() },
+				pb = { (i & 1) ? b.uDomain.end() : b.uDomain.beg(), (i & 2) ? b.vDomain.end() : b.vDomain.beg() };
+			refined = fMaxDistanceLocal(a, b, atob, btoa, pa, pb);
+			if (refined.length > distance.length)
+				distance = refined;
+		}
+		exact = distance.length >= bound;
+		return distance;
+	}
+	Distance TorusDistance::maxDistanceLocal(const TorusPatch& a, const TorusPatch& b, const Transform& ta, const Transform& tb, Real2 pa, Real2 pb) {
+		Transform atob, btoa;
+		atob = Transform::connect(ta, tb);
+		btoa = Transform::connect(tb, ta);
+		return fMaxDistanceLocal(a, b, atob, btoa, pa, pb);
+	}
+	// Alternating farthest point projection between [ sa ] and [ sb ], starting from [ pointA ] of [ distance ] if [ projectOnB ], otherwise from [ pointB ]
+	inline static void maxDistanceProjection(const StaticTorusPatch& sa, const StaticTorusPatch& sb, const Transform& atob, const Transform& btoa, bool projectOnB, Distance& distance) {
+		const static int itermax = 100;
+		Vec3 tmppt;
+		Real maxd = -1.0, curd;
+		int iter = 0;
+
+		// Farthest point projection never decreases distance, so stop when it does not increase
+		while (true) {
+			if (projectOnB) {
+				tmppt = atob.apply(distance.pointA);
+				sb.findMaxDistParam(tmppt, distance.paramB[0], distance.paramB[1]);
+				distance.pointB = sb.evaluate(distance.paramB[0], distance.paramB[1]);
+				curd = tmppt.distsq(distance.pointB);
+			}
+			else {
+				tmppt = btoa.apply(distance.pointB);
+				sa.findMaxDistParam(tmppt, distance.paramA[0], distance.paramA[1]);
+				distance.pointA = sa.evaluate(distance.paramA[0], distance.paramA[1]);
+				curd = tmppt.distsq(distance.pointA);
+			}
+			if (curd > maxd)
+				maxd = curd;
+			else
+				break;
+			projectOnB = !projectOnB;
+			if (++iter > itermax)
+				break;
+		}
+		distance.length = sqrt(maxd);
+	}
+	Distance TorusDistance::fMaxDistanceLocal(const TorusPatch& a, const TorusPatch& b, const Transform& atob, const Transform& btoa, Real2 pa, Real2 pb) {
+		StaticTorusPatch sa = StaticTorusPatch::create(a), sb = StaticTorusPatch::create(b);	// Devirtualized projections
+		Distance fromA, fromB;
+
+		// Start from A(pa) and from B(pb), since projection only reaches local maximum
+		fromA.paramA[0] = pa.first;
+		fromA.paramA[1] = pa.second;
+		fromA.pointA = sa.evaluate(pa.first, pa.second);
+		maxDistanceProjection(sa, sb, atob, btoa, true, fromA);
+
+		fromB.paramB[0] = pb.first;
+		fromB.paramB[1] = pb.second;
+		fromB.pointB = sb.evaluate(pb.first, pb.second);
+		maxDistanceProjection(sa, sb, atob, btoa, false, fromB);
+
+		return (fromB.length > fromA.length) ? fromB : fromA;
+	}
+
+	// Capsule
+	// Candidate of minimum distance between [ patch ] at ( [ u ], [ v ] ) and segment point [ pt ] ( parameter [ s ] )
+	inline static void capsuleCandidate(const StaticTorusPatch& patch, Real u, Real v, const Vec3& pt, Real s, Distance& distance) {
+		Vec3 ppt = patch.evaluate(u, v);
+		Real length = ppt.dist(pt);
+		if (length >= distance.length)
+			return;
+		distance.length = length;
+		distance.paramA[0] = u;
+		distance.paramA[1] = v;
+		distance.pointA = ppt;
+		distance.paramB[0] = s;
+		distance.pointB = pt;
+	}
+	// Same as above, but [ v ] is in the direction of [ pt ] from the major circle point at [ u ]
+	inline static void capsuleCandidate(const StaticTorusPatch& patch, Real u, const Vec3& pt, Real s, Distance& distance) {
+		Real
+			radial = pt[0] * cos(u) + pt[1] * sin(u) - patch.majorRadius,
+			v = (radial == 0.0 && pt[2] == 0.0) ? patch.vDomain.middle() : piDomain::regularize(atan2(pt[2], radial));
+		if (patch.vDomain.has(v))
+			capsuleCandidate(patch, u, v, pt, s, distance);
+	}
+	Distance TorusDistance::minDistance(const TorusPatch& tpatch, const Capsule& capsule) {
+		StaticTorusPatch patch = StaticTorusPatch::create(tpatch);
+		const Segment& seg = capsule.segment;
+		const Vec3 dir = seg.end - seg.beg;
+		const bool uFull = patch.uDomain.width() >= PI20, vFull = patch.vDomain.width() >= PI20;
+		Distance distance;
+		distance.length = maxDouble;
+
+		// 1. End points of the segment
+		{
+			Real params[2] = { 0.0, 1.0 };
+			for (int i = 0; i < 2; i++) {
+				Vec3 pt = seg.beg + dir * params[i];
+				Real u, v;
+				patch.findMinDistParamBoundary(pt, u, v);		// Exact, since the closest point is often on the boundary
+				capsuleCandidate(patch, u, v, pt, params[i], distance);
+			}
+		}
+
+		Real lensq = dir.lensq();
+		Real samples[lineCriticalMaxNum + 3];		// Segment parameters where signed distance to the full torus is examined for crossing
+		int sampleNum = 0;
+		samples[sampleNum++] = 0.0;
+		samples[sampleNum++] = 1.0;
+		if (lensq > 0.0) {
+			// 2. Critical points in the inner part of [ patch ]
+			Line line;
+			line.point = seg.beg;
+			line.direction = dir;
+			Real params[lineCriticalMaxNum];
+			int paramNum;
+			lineCriticalParams(patch.majorCircle(), line, params, paramNum);
+			for (int i = 0; i < paramNum; i++) {
+				Vec3 mpt = patch.majorCircle().evaluate(params[i]);
+				Real s = (mpt - seg.beg).dot(dir) / lensq;
+				if (s <= 0.0 || s >= 1.0)
+					continue;
+				samples[sampleNum++] = s;
+				if (uFull || patch.uDomain.has(params[i]))
+					capsuleCandidate(patch, params[i], seg.beg + dir * s, s, distance);
+			}
+
+			// 3. Boundary arcs of [ patch ]
+			if (!vFull) {
+				Real params[2] = { patch.vDomain.beg(), patch.vDomain.end() };
+				for (int i = 0; i < 2; i++) {
+					// Circle of latitude at [ v ], which is coaxial with the torus
+					CircularArc arc;
+					arc.radius = patch.majorRadius + patch.minorRadius * cos(params[i]);
+					arc.domain = patch.uDomain;
+					Vec3 offset{ 0.0, 0.0, patch.minorRadius * sin(params[i]) };
+					Segment lseg;
+					lseg.beg = seg.beg - offset;
+					lseg.end = seg.end - offset;
+					Distance d = MN::distance(arc, lseg);
+					capsuleCandidate(patch, d.paramA[0], params[i], seg.beg + dir * d.paramB[0], d.paramB[0], distance);
+				}
+			}
+			if (!uFull) {
+				Real params[2] = { patch.uDomain.beg(), patch.uDomain.end() };
+				for (int i = 0; i < 2; i++) {
+					// Minor circle at [ u ]
+					Transform transform = patch.uTransform(params[i]);
+					CircularArc arc = patch.minorCircularArc();
+					Segment lseg;
+					lseg.beg = transform.apply(seg.beg);
+					lseg.end = transform.apply(seg.end);
+					Distance d = MN::distance(arc, lseg);
+					capsuleCandidate(patch, params[i], d.paramA[0], seg.beg + dir * d.paramB[0], d.paramB[0], distance);
+				}
+			}
+
+			// 4. Segment could cross [ patch ], where distance is zero but not critical
+			// Signed distance to the full torus is monotone between critical points and the point closest to the axis ( where it could have a kink ),
+			// so crossings are bracketed by those samples
+			if (distance.length > 0.0) {
+				Real axisLensq = SQ(dir[0]) + SQ(dir[1]);
+				if (axisLensq > 0.0) {
+					Real s = -(seg.beg[0] * dir[0] + seg.beg[1] * dir[1]) / axisLensq;
+					if (s > 0.0 && s < 1.0)
+						samples[sampleNum++] = s;
+				}
+				std::sort(samples, samples + sampleNum);
+				Real s0 = samples[0], f0 = patch.signedDistance(seg.beg + dir * s0);
+				for (int i = 1; i < sampleNum && distance.length > 0.0; i++) {
+					Real s1 = samples[i], f1 = patch.signedDistance(seg.beg + dir * s1);
+					if ((f0 < 0.0) != (f1 < 0.0)) {
+						Real lo = s0, hi = s1;
+						for (int k = 0; k < CROSS_ITER; k++) {
+							Real mid = 0.5 * (lo + hi);
+							if ((patch.signedDistance(seg.beg + dir * mid) < 0.0) == (f0 < 0.0)) lo = mid;
+							else hi = mid;
+						}
+						Vec3 pt = seg.beg + dir * (0.5 * (lo + hi));
+						Real
+							u = piDomain::regularize(atan2(pt[1], pt[0])),
+							v = piDomain::regularize(atan2(pt[2], sqrt(SQ(pt[0]) + SQ(pt[1])) - patch.majorRadius));
+						if ((uFull || patch.uDomain.has(u)) && (vFull || patch.vDomain.has(v)))
+							capsuleCandidate(patch, u, v, pt, 0.5 * (lo + hi), distance);
+					}
+					s0 = s1;
+					f0 = f1;
+				}
+			}
+		}
+
+		// Move [ pointB ] from the segment to the capsule surface
+		if (distance.length > capsule.radius) {
+			distance.pointB += (distance.pointA - distance.pointB) * (capsule.radius / distance.length);
+			distance.length -= capsule.radius;
+		}
+		else {
+			distance.pointB = distance.pointA;
+			distance.length = 0.0;
+		}
+		return distance;
+	}
 }
\ No newline at end of file
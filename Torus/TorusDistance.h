@@ -14,6 +14,7 @@
 #endif
 
 #include "..//Distance.h"
+#include "../Line.h"
 #include "Torus.h"
 
 namespace MN {
@@ -21,6 +22,29 @@ namespace MN {
 	public:
 		static Distance minDistanceLocal(const TorusPatch& a, const TorusPatch& b, const Transform& ta, const Transform& tb, Real2 pa, Real2 pb);
 		static Distance fMinDistanceLocal(const TorusPatch& a, const TorusPatch& b, const Transform& atob, const Transform& btoa, Real2 pa, Real2 pb);
+
+		// Maximum distance between two tori, which is maximum distance between their major circles plus both minor radii
+		// Farthest pair on major circles is connected by a binormal, so it lies in the planes of both minor circles there
+		// @return : [ paramA ], [ paramB ] are ( u, v ) of [ pointA ], [ pointB ], which are given in local coordinates of each torus
+		static Distance maxDistance(const Torus& a, const Torus& b, const Transform& ta, const Transform& tb);
+		// Maximum distance between two torus patches, starting from farthest pair of major arcs
+		// If the farthest points on minor arcs there fall to the boundary of [ vDomain ], the pair and corners of patches are refined by [ fMaxDistanceLocal ],
+		// which only gives local maximum
+		// @exact :	True if [ length ] reaches maximum distance between major arcs plus both minor radii, which is an upper bound,
+		//			so that [ length ] is the maximum distance
+		//			If false, [ length ] is the largest local maximum found, which is only a lower bound of the maximum distance
+		static Distance maxDistance(const TorusPatch& a, const TorusPatch& b, const Transform& ta, const Transform& tb, bool& exact);
+		// Local maximum distance by farthest point projection alternating between patches, started from both A( [ pa ] ) and B( [ pb ] ),
+		// and the larger one is returned
+		static Distance maxDistanceLocal(const TorusPatch& a, const TorusPatch& b, const Transform& ta, const Transform& tb, Real2 pa, Real2 pb);
+		static Distance fMaxDistanceLocal(const TorusPatch& a, const TorusPatch& b, const Transform& atob, const Transform& btoa, Real2 pa, Real2 pb);
+
+		// Minimum distance between [ patch ] and [ capsule ] given in [ patch ]'s local coordinates
+		// Critical points in the inner part of [ patch ] come from distance between its major circle and the capsule's segment,
+		// and the rest are found on boundary arcs of [ patch ] and end points of the segment
+		// @return : [ pointA ] and [ paramA ] are on [ patch ], [ pointB ] is on the capsule and [ paramB[0] ] is the segment parameter ( in [ 0, 1 ] )
+		//			If they overlap, [ length ] is 0 and [ pointB ] is a common point
+		static Distance minDistance(const TorusPatch& patch, const Capsule& capsule);
 	};
 }
 
@@ -0,0 +1,336 @@
+/*
+ *******************************************************************************************
+ * Author	: Sang Hyun Son
+ * Email	: shh1295@gmail.com
+ * Github	: github.com/SonSang
+ *******************************************************************************************
+ */
+
+#include "TorusIntersect.h"
+#include "../Polynomial.h"
+
+#define RAY_HIT_EPS		1e-9		// Distance to torus surface ( relative to R + r ) where root candidate is accepted as hit
+#define RAY_ROOT_EPS	1e-12		// Step size where root search of packet stops ( same as [ Polynomial::monotoneRoot ] )
+#define RAY_ROOT_ITER	64			// Maximum number of safeguarded Newton steps of packet ( same as [ Polynomial::monotoneRoot ] )
+
+namespace MN {
+	// Range [ lo, hi ] of ray [ o + s * d ] ( [ d ] is unit vector and [ o ] is the closest point to the center ) that could hit torus,
+	// which is clipped by bounding sphere and slab [ |z| <= r ]
+	// Written without branches, so that it vectorizes in packets
+	// @return : False if the range is empty
+	inline static bool rayRange(Real R, Real r, Real ox, Real oy, Real oz, Real dz, Real& lo, Real& hi) {
+		Real
+			sphere = SQ(R + r) - (SQ(ox) + SQ(oy) + SQ(oz)),
+			half = sqrt((sphere > 0.0) ? sphere : 0.0),
+			invDz = 1.0 / ((dz != 0.0) ? dz : 1.0),
+			s0 = (-r - oz) * invDz,
+			s1 = (r - oz) * invDz,
+			slabLo = (dz != 0.0) ? ((s0 < s1) ? s0 : s1) : -maxDouble,
+			slabHi = (dz != 0.0) ? ((s0 < s1) ? s1 : s0) : maxDouble;
+		bool inSlab = (dz != 0.0) | (fabs(oz) <= r);
+		lo = (lo > -half) ? lo : -half;
+		lo = (lo > slabLo) ? lo : slabLo;
+		hi = (hi < half) ? hi : half;
+		hi = (hi < slabHi) ? hi : slabHi;
+		return (sphere >= 0.0) & inSlab & (lo <= hi);
+	}
+	// Coefficients of quartic in [ s ] ( ascending order ) for ray [ o + s * d ] with unit [ d ]
+	// @stride : Distance between coefficients in [ coef ], which is packet size for coefficients in structure of arrays
+	inline static void rayCoefs(Real R, Real r, Real ox, Real oy, Real oz, Real dx, Real dy, Real dz, Real coef[], int stride) {
+		Real
+			k = SQ(ox) + SQ(oy) + SQ(oz) + SQ(R) - SQ(r),
+			m = ox * dx + oy * dy + oz * dz,
+			R4 = 4.0 * SQ(R);
+		coef[4 * stride] = 1.0;
+		coef[3 * stride] = 4.0 * m;
+		coef[2 * stride] = 2.0 * k + 4.0 * SQ(m) - R4 * (SQ(dx) + SQ(dy));
+		coef[stride] = 4.0 * k * m - 2.0 * R4 * (ox * dx + oy * dy);
+		coef[0] = SQ(k) - R4 * (SQ(ox) + SQ(oy));
+	}
+	// Roots [ b0 <= b1 ] of the second derivative of monic quartic ( [ c2 ], [ c3 ] are its coefficients ), which separate roots of its derivative
+	// Written without branches in closed form, so that it vectorizes in packets
+	// If there is no real root, both are [ -maxDouble ]
+	inline static void rayBreaks(Real c2, Real c3, Real& b0, Real& b1) {
+		// 12s^2 + 6 * c3 * s + 2 * c2 = 0
+		Real
+			b = 6.0 * c3,
+			c = 2.0 * c2,
+			disc = SQ(b) - 48.0 * c,
+			sq = sqrt((disc > 0.0) ? disc : 0.0),
+			q = -0.5 * (b + ((b < 0.0) ? -sq : sq)),
+			r0 = q / 12.0,
+			r1 = (q != 0.0) ? c / q : r0;
+		b0 = (disc < 0.0) ? -maxDouble : ((r0 < r1) ? r0 : r1);
+		b1 = (disc < 0.0) ? -maxDouble : ((r0 < r1) ? r1 : r0);
+	}
+	// Whether ray point at [ s ] is on torus ( and in domains, if given ), and its ( u, v ) and outward normal
+	inline static bool rayCandidate(const TorusShape& torus, const piDomain* uDomain, const piDomain* vDomain, const Vec3& o, const Vec3& d, Real s, Real2& param, Vec3& normal) {
+		Vec3 pt = o + d * s;
+		Real
+			rho = sqrt(SQ(pt[0]) + SQ(pt[1])),
+			w = rho - torus.majorRadius,
+			len = sqrt(SQ(w) + SQ(pt[2]));
+		if (fabs(len - torus.minorRadius) > RAY_HIT_EPS * (torus.majorRadius + torus.minorRadius) || len == 0.0)
+			return false;
+		Real
+			u = piDomain::regularize(atan2(pt[1], pt[0])),
+			v = piDomain::regularize(atan2(pt[2], w));
+		if ((uDomain != nullptr && !uDomain->has(u)) || (vDomain != nullptr && !vDomain->has(v)))
+			return false;
+		Real
+			cu = (rho > 0.0) ? pt[0] / rho : 1.0,
+			su = (rho > 0.0) ? pt[1] / rho : 0.0;
+		param = { u, v };
+		normal = Vec3{ w * cu, w * su, pt[2] } / len;
+		return true;
+	}
+	// Examine quartic in [ x0, x1 ], where it is monotone, and [ x1 ] itself if it is a critical point
+	// [ x0 ], [ v0 ] move to [ x1 ] for the next interval
+	// @return : True if a hit is found
+	inline static bool rayInterval(const TorusShape& torus, const piDomain* uDomain, const piDomain* vDomain, const Real coef[5], Real& x0, Real& v0, Real x1, bool critical,
+		const Vec3& o, const Vec3& d, Real& s, Real2& param, Vec3& normal) {
+		Real deriv, v1 = Polynomial::evaluate(coef, 4, x1, deriv);
+		if (v0 * v1 < 0.0) {
+			s = Polynomial::monotoneRoot(coef, 4, x0, x1, v0, v1);
+			if (rayCandidate(torus, uDomain, vDomain, o, d, s, param, normal))
+				return true;
+		}
+		if ((critical || v1 == 0.0) && rayCandidate(torus, uDomain, vDomain, o, d, x1, param, normal)) {
+			s = x1;
+			return true;
+		}
+		x0 = x1;
+		v0 = v1;
+		return false;
+	}
+	// The smallest root in [ lo, hi ] that is on torus ( and in domains, if given )
+	// Quartic is monotone between its critical points, which are visited in ascending order until a hit is found
+	// Critical points are roots of derivative cubic, which is monotone between [ b0 ] and [ b1 ] ( see [ rayBreaks ] )
+	// Critical points themselves are examined as well, since tangent hits do not change sign
+	// @s, param, normal : Ray parameter, ( u, v ) and outward normal of hit
+	static bool rayRoot(const TorusShape& torus, const piDomain* uDomain, const piDomain* vDomain, const Real coef[5], Real b0, Real b1, Real lo, Real hi,
+		const Vec3& o, const Vec3& d, Real& s, Real2& param, Vec3& normal) {
+		Real
+			dcoef[4] = { coef[1], 2.0 * coef[2], 3.0 * coef[3], 4.0 * coef[4] },
+			breaks[3] = { b0, b1, hi },
+			deriv;
+
+		Real x0 = lo, v0 = Polynomial::evaluate(coef, 4, lo, deriv);
+		if (v0 == 0.0 && rayCandidate(torus, uDomain, vDomain, o, d, lo, param, normal)) {
+			s = lo;
+			return true;
+		}
+		Real c0 = lo, w0 = Polynomial::evaluate(dcoef, 3, lo, deriv);
+		for (int i = 0; i < 3; i++) {
+			Real c1 = breaks[i];
+			if (c1 <= c0 || c1 > hi)
+				continue;
+			Real w1 = Polynomial::evaluate(dcoef, 3, c1, deriv);
+			if (w0 * w1 < 0.0 &&
+				rayInterval(torus, uDomain, vDomain, coef, x0, v0, Polynomial::monotoneRoot(dcoef, 3, c0, c1, w0, w1), true, o, d, s, param, normal))
+				return true;
+			if (rayInterval(torus, uDomain, vDomain, coef, x0, v0, c1, c1 < hi, o, d, s, param, normal))
+				return true;
+			c0 = c1;
+			w0 = w1;
+		}
+		return false;
+	}
+	static bool rayTorus(const TorusShape& torus, const piDomain* uDomain, const piDomain* vDomain, const Ray& ray, Real tMin, Real tMax, RayHit& hit) {
+		Real len = ray.direction.len();
+		if (len == 0.0)
+			return false;
+		Vec3 d = ray.direction / len;
+		Real t0 = -ray.origin.dot(d);
+		Vec3 o = ray.origin + d * t0;
+
+		// Ray parameter [ t ] is [ ( s + t0 ) / len ]
+		Real lo = tMin * len - t0, hi = tMax * len - t0;
+		if (!rayRange(torus.majorRadius, torus.minorRadius, o[0], o[1], o[2], d[2], lo, hi))
+			return false;
+		Real coef[5], b0, b1, s;
+		rayCoefs(torus.majorRadius, torus.minorRadius, o[0], o[1], o[2], d[0], d[1], d[2], coef, 1);
+		rayBreaks(coef[2], coef[3], b0, b1);
+		if (!rayRoot(torus, uDomain, vDomain, coef, b0, b1, lo, hi, o, d, s, hit.param, hit.normal))
+			return false;
+		hit.t = (s + t0) / len;
+		return true;
+	}
+	bool intersect(const Torus& torus, const Ray& ray, Real tMin, Real tMax, RayHit& hit) {
+		return rayTorus(torus, nullptr, nullptr, ray, tMin, tMax, hit);
+	}
+	bool intersect(const TorusPatch& patch, const Ray& ray, Real tMin, Real tMax, RayHit& hit) {
+		return rayTorus(patch, &patch.uDomain, &patch.vDomain, ray, tMin, tMax, hit);
+	}
+
+	// Packet
+	// Value of polynomial of degree [ D ] ( coefficients in ascending order ) for all lanes, same as [ Polynomial::evaluate ]
+	template<int N, int D>
+	inline static void packetEvaluate(const Real (&coef)[D + 1][N], const Real x[N], Real value[N]) {
+		for (int i = 0; i < N; i++) {
+			Real v = coef[D][i];
+			for (int j = D - 1; j >= 0; j--)
+				v = v * x[i] + coef[j][i];
+			value[i] = v;
+		}
+	}
+	// [ Polynomial::monotoneRoot ] for all lanes in lockstep, until every lane in [ valid ] converges
+	// Lanes stop at the same step as [ Polynomial::monotoneRoot ] would, so roots are the same as those of scalar path
+	// @valid : 1 for lanes that change sign in [ x0, x1 ], 0 for the others, whose [ x ] is not defined
+	template<int N, int D>
+	inline static void packetMonotoneRoot(const Real (&coef)[D + 1][N], const Real x0[N], const Real x1[N], const Real v0[N], const Real v1[N], const Real valid[N], Real x[N]) {
+		Real a[N], b[N], running[N];
+		for (int i = 0; i < N; i++) {
+			Real dv = (v1[i] != v0[i]) ? v1[i] - v0[i] : 1.0;
+			a[i] = x0[i];
+			b[i] = x1[i];
+			x[i] = x0[i] - v0[i] * (x1[i] - x0[i]) / dv;
+			running[i] = valid[i];
+		}
+		for (int k = 0; k < RAY_ROOT_ITER; k++) {
+			Real runningNum = 0.0;
+			for (int i = 0; i < N; i++) {
+				Real value = coef[D][i], deriv = 0.0, xi = x[i];
+				for (int j = D - 1; j >= 0; j--) {
+					deriv = deriv * xi + value;
+					value = value * xi + coef[j][i];
+				}
+				bool same = (value < 0.0) == (v0[i] < 0.0);
+				a[i] = same ? xi : a[i];
+				b[i] = same ? b[i] : xi;
+				Real nx = xi - value / ((deriv != 0.0) ? deriv : 1.0);
+				nx = (deriv != 0.0 && nx > a[i] && nx < b[i]) ? nx : 0.5 * (a[i] + b[i]);
+
+				// Lanes that hit a root stay, and lanes whose step is small take the step and stop
+				Real go = (running[i] != 0.0 && value != 0.0) ? 1.0 : 0.0;
+				x[i] = (go != 0.0) ? nx : xi;
+				running[i] = (go != 0.0 && fabs(nx - xi) > RAY_ROOT_EPS) ? 1.0 : 0.0;
+				runningNum += running[i];
+			}
+			if (runningNum == 0.0)
+				break;
+		}
+	}
+	template<int N>
+	int intersect(const TorusPatch& patch, const RayPacket<N>& packet, RayPacketHit<N>& hit) {
+		const Real
+			R = patch.majorRadius,
+			r = patch.minorRadius;
+		Real
+			ox[N], oy[N], oz[N], dx[N], dy[N], dz[N],
+			t0[N], lens[N], lo[N], hi[N],
+			coef[5][N], dcoef[4][N], b0[N], b1[N],
+			running[N];
+
+		// 1. Normalize, move origin, cull by bounding sphere and slab, and find quartic with its breaks for all lanes
+		// Direction is divided by its length as in scalar path, since grazing hits are sensitive to rounding
+		for (int i = 0; i < N; i++) {
+			Real len = sqrt(SQ(packet.dx[i]) + SQ(packet.dy[i]) + SQ(packet.dz[i]));
+			lens[i] = (len > 0.0) ? len : 1.0;
+			dx[i] = packet.dx[i] / lens[i];
+			dy[i] = packet.dy[i] / lens[i];
+			dz[i] = packet.dz[i] / lens[i];
+			t0[i] = -(packet.ox[i] * dx[i] + packet.oy[i] * dy[i] + packet.oz[i] * dz[i]);
+			ox[i] = packet.ox[i] + dx[i] * t0[i];
+			oy[i] = packet.oy[i] + dy[i] * t0[i];
+			oz[i] = packet.oz[i] + dz[i] * t0[i];
+			lo[i] = packet.tMin[i] * len - t0[i];
+			hi[i] = packet.tMax[i] * len - t0[i];
+			running[i] = (rayRange(R, r, ox[i], oy[i], oz[i], dz[i], lo[i], hi[i]) & (len > 0.0)) ? 1.0 : 0.0;
+			rayCoefs(R, r, ox[i], oy[i], oz[i], dx[i], dy[i], dz[i], &coef[0][i], N);
+			rayBreaks(coef[2][i], coef[3][i], b0[i], b1[i]);
+			for (int j = 0; j < 4; j++)
+				dcoef[j][i] = (j + 1) * coef[j + 1][i];
+		}
+
+		// 2. Points where quartic could change monotonicity, in ascending order : [ root of cubic, break ] for 3 intervals of cubic
+		// Breaks are clamped to [ lo, hi ], and missing roots are the left end of their interval, so empty intervals are skipped below
+		Real edges[4][N], w[4][N], points[6][N], valid[N];
+		for (int i = 0; i < N; i++) {
+			Real
+				e1 = (b0[i] > lo[i]) ? b0[i] : lo[i],
+				e2 = (b1[i] > lo[i]) ? b1[i] : lo[i];
+			edges[0][i] = lo[i];
+			edges[1][i] = (e1 < hi[i]) ? e1 : hi[i];
+			edges[2][i] = (e2 < hi[i]) ? e2 : hi[i];
+			edges[3][i] = hi[i];
+		}
+		for (int j = 0; j < 4; j++)
+			packetEvaluate<N, 3>(dcoef, edges[j], w[j]);
+		for (int j = 0; j < 3; j++) {
+			for (int i = 0; i < N; i++)
+				valid[i] = (running[i] != 0.0 && w[j][i] * w[j + 1][i] < 0.0) ? 1.0 : 0.0;
+			packetMonotoneRoot<N, 3>(dcoef, edges[j], edges[j + 1], w[j], w[j + 1], valid, points[2 * j]);
+			for (int i = 0; i < N; i++) {
+				points[2 * j][i] = (valid[i] != 0.0) ? points[2 * j][i] : edges[j][i];
+				points[2 * j + 1][i] = edges[j + 1][i];
+			}
+		}
+
+		// 3. Walk monotone intervals of quartic in lockstep, where each lane stops at its first hit
+		// Points in the inner part of range are examined as well, since tangent hits do not change sign ( see [ rayRoot ] )
+		Real x0[N], v0[N], v1[N], s[N];
+		int hitNum = 0;
+		packetEvaluate<N, 4>(coef, lo, v0);
+		for (int i = 0; i < N; i++) {
+			hit.hit[i] = false;
+			x0[i] = lo[i];
+		}
+		for (int k = -1; k < 6; k++) {
+			const Real* x1 = (k < 0) ? lo : points[k];
+			if (k >= 0) {
+				packetEvaluate<N, 4>(coef, x1, v1);
+				for (int i = 0; i < N; i++)
+					valid[i] = (running[i] != 0.0 && x1[i] > x0[i] && v0[i] * v1[i] < 0.0) ? 1.0 : 0.0;
+				packetMonotoneRoot<N, 4>(coef, x0, x1, v0, v1, valid, s);
+			}
+			Real runningNum = 0.0;
+			for (int i = 0; i < N; i++) {
+				if (running[i] == 0.0)
+					continue;
+				const Vec3
+					o{ ox[i], oy[i], oz[i] },
+					d{ dx[i], dy[i], dz[i] };
+				Real hs;
+				Real2 param;
+				Vec3 normal;
+				bool found = false;
+				if (k < 0) {
+					// [ lo ] itself
+					hs = lo[i];
+					found = v0[i] == 0.0 && rayCandidate(patch, &patch.uDomain, &patch.vDomain, o, d, hs, param, normal);
+				}
+				else if (x1[i] > x0[i]) {
+					if (valid[i] != 0.0) {
+						hs = s[i];
+						found = rayCandidate(patch, &patch.uDomain, &patch.vDomain, o, d, hs, param, normal);
+					}
+					if (!found && (x1[i] < hi[i] || v1[i] == 0.0)) {
+						hs = x1[i];
+						found = rayCandidate(patch, &patch.uDomain, &patch.vDomain, o, d, hs, param, normal);
+					}
+					x0[i] = x1[i];
+					v0[i] = v1[i];
+				}
+				if (found) {
+					hit.hit[i] = true;
+					hit.t[i] = (hs + t0[i]) / lens[i];
+					hit.u[i] = param.first;
+					hit.v[i] = param.second;
+					hit.nx[i] = normal[0];
+					hit.ny[i] = normal[1];
+					hit.nz[i] = normal[2];
+					running[i] = 0.0;
+					hitNum++;
+				}
+				runningNum += running[i];
+			}
+			if (runningNum == 0.0)
+				break;
+		}
+		return hitNum;
+	}
+	template int intersect<4>(const TorusPatch& patch, const RayPacket<4>& packet, RayPacketHit<4>& hit);
+	template int intersect<8>(const TorusPatch& patch, const RayPacket<8>& packet, RayPacketHit<8>& hit);
+	template int intersect<16>(const TorusPatch& patch, const RayPacket<16>& packet, RayPacketHit<16>& hit);
+}
\ No newline at end of file
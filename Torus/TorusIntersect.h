@@ -0,0 +1,70 @@
+/*
+ *******************************************************************************************
+ * Author	: Sang Hyun Son
+ * Email	: shh1295@gmail.com
+ * Github	: github.com/SonSang
+ *******************************************************************************************
+ */
+
+#ifndef __MN_TORUS_INTERSECT_H__
+#define __MN_TORUS_INTERSECT_H__
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#include "../Line.h"
+#include "Torus.h"
+
+namespace MN {
+	// Closest hit of a ray on torus surface
+	class RayHit {
+	public:
+		Real t;			// Ray parameter
+		Real2 param;	// ( u, v ) of hit point
+		Vec3 normal;	// Outward normal at hit point
+	};
+	// Packet of [ N ] rays in structure of arrays ( N = 4, 8, 16 )
+	template<int N>
+	class RayPacket {
+	public:
+		Real ox[N], oy[N], oz[N];	// Origins
+		Real dx[N], dy[N], dz[N];	// Directions ( do not have to be normalized )
+		Real tMin[N], tMax[N];		// Range of ray parameters
+	};
+	template<int N>
+	class RayPacketHit {
+	public:
+		bool hit[N];
+		Real t[N];
+		Real u[N], v[N];
+		Real nx[N], ny[N], nz[N];	// Outward normals
+	};
+
+	// Ray - Torus intersection
+	// Torus is [ ( |p|^2 + R^2 - r^2 )^2 = 4R^2 ( px^2 + py^2 ) ], which gives quartic in ray parameter
+	// For robustness, origin is moved to the closest point to the torus center on the ray and direction is normalized before forming quartic,
+	// and real roots are isolated between critical points in the range clipped by bounding sphere and slab [ |z| <= r ]
+	// @ ray : Ray in [ torus ]'s local coordinates
+	// @ tMin, tMax : Range of ray parameter
+	// @ hit : The closest hit in the range
+	// @ ret : True if there is a hit
+	bool intersect(const Torus& torus, const Ray& ray, Real tMin, Real tMax, RayHit& hit);
+
+	// Patch version of above, hits out of [ uDomain ] or [ vDomain ] are skipped
+	bool intersect(const TorusPatch& patch, const Ray& ray, Real tMin, Real tMax, RayHit& hit);
+
+	// Packet version of above for coherent rays ( e.g. camera rays ), which gives the same hits
+	// Normalization, culling by bounding sphere and slab, quartic coefficients and root isolation run for all lanes in lockstep over structure of arrays,
+	// and only candidates of hits are tested per lane ( needs -O3 with -fno-math-errno and -fno-trapping-math on GCC to vectorize,
+	// otherwise lockstep is slower than scalar path, see Benchmark/TorusRayBenchmark.cpp )
+	// @ ret : Number of rays that hit [ patch ]
+	template<int N>
+	int intersect(const TorusPatch& patch, const RayPacket<N>& packet, RayPacketHit<N>& hit);
+
+	extern template int intersect<4>(const TorusPatch& patch, const RayPacket<4>& packet, RayPacketHit<4>& hit);
+	extern template int intersect<8>(const TorusPatch& patch, const RayPacket<8>& packet, RayPacketHit<8>& hit);
+	extern template int intersect<16>(const TorusPatch& patch, const RayPacket<16>& packet, RayPacketHit<16>& hit);
+}
+
+#endif
\ No newline at end of file
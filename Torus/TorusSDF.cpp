@@ -0,0 +1,177 @@
+/*
+ *******************************************************************************************
+ * Author	: Sang Hyun Son
+ * Email	: shh1295@gmail.com
+ * Github	: github.com/SonSang
+ *******************************************************************************************
+ */
+
+#include "TorusSDF.h"
+#include <algorithm>
+#include <thread>
+
+#define SDF_BRICK		8			// Number of voxels along each side of a brick
+#define SDF_BRICK_VOXEL	512			// Number of voxels in a brick ( SDF_BRICK ^ 3 )
+
+namespace MN {
+	TorusSDF::Primitive TorusSDF::Primitive::create(const Torus& torus, const Transform& transform) {
+		Primitive primitive;
+		primitive.patch.majorRadius = torus.majorRadius;
+		primitive.patch.minorRadius = torus.minorRadius;
+		primitive.patch.uDomain = piDomain::create(0, PI20);
+		primitive.patch.vDomain = piDomain::create(0, PI20);
+		primitive.transform = transform;
+		return primitive;
+	}
+	TorusSDF::Primitive TorusSDF::Primitive::create(const TorusPatch& patch, const Transform& transform) {
+		Primitive primitive;
+		primitive.patch.majorRadius = patch.majorRadius;
+		primitive.patch.minorRadius = patch.minorRadius;
+		primitive.patch.uDomain = patch.uDomain;
+		primitive.patch.vDomain = patch.vDomain;
+		primitive.transform = transform;
+		return primitive;
+	}
+
+	// Primitive prepared for baking
+	class BakePrimitive {
+	public:
+		const TorusPatch* patch;
+		Transform toLocal;			// World to local coordinates of torus
+		int brickBeg[3];
+		int brickEnd[3];			// Range of bricks that overlap bounding box expanded by band, [ beg, end )
+	};
+	inline static BakePrimitive prepare(const TorusSDF::Primitive& primitive, const TorusSDF::Grid& grid, const int brickNum[3]) {
+		BakePrimitive bp;
+		bp.patch = &primitive.patch;
+		bp.toLocal = primitive.transform.inverse();
+
+		// Bounding box of full torus in world coordinates
+		Real
+			xy = primitive.patch.majorRadius + primitive.patch.minorRadius,
+			z = primitive.patch.minorRadius;
+		Vec3 lo = primitive.transform.apply({ -xy, -xy, -z }), hi = lo;
+		for (int i = 1; i < 8; i++) {
+			Vec3 corner = primitive.transform.apply({ (i & 1) ? xy : -xy, (i & 2) ? xy : -xy, (i & 4) ? z : -z });
+			for (int j = 0; j < 3; j++) {
+				lo[j] = std::min(lo[j], corner[j]);
+				hi[j] = std::max(hi[j], corner[j]);
+			}
+		}
+		for (int j = 0; j < 3; j++) {
+			Real
+				beg = (lo[j] - grid.band - grid.origin[j]) / grid.spacing,
+				end = (hi[j] + grid.band - grid.origin[j]) / grid.spacing;
+			bp.brickBeg[j] = std::max(0, (int)floor(beg) / SDF_BRICK);
+			bp.brickEnd[j] = std::min(brickNum[j], (int)floor(end) / SDF_BRICK + 1);
+			if (end < 0)
+				bp.brickEnd[j] = 0;
+		}
+		return bp;
+	}
+	// Bake bricks [ t, t + threadNum, t + 2 * threadNum, ... ], so that each voxel is written by only one thread
+	static void bakeBricks(const std::vector<BakePrimitive>& primitives, TorusSDF::Grid& grid, const int brickNum[3], int t, int threadNum) {
+		const Real
+			band = grid.band,
+			halfDiagonal = 0.5 * sqrt(3.0) * SDF_BRICK * grid.spacing;
+		Real
+			x[SDF_BRICK_VOXEL], y[SDF_BRICK_VOXEL], z[SDF_BRICK_VOXEL],
+			u[SDF_BRICK_VOXEL], v[SDF_BRICK_VOXEL],
+			cx[SDF_BRICK_VOXEL], cy[SDF_BRICK_VOXEL], cz[SDF_BRICK_VOXEL];
+		int total = brickNum[0] * brickNum[1] * brickNum[2];
+		for (int brick = t; brick < total; brick += threadNum) {
+			int
+				bi = brick % brickNum[0],
+				bj = (brick / brickNum[0]) % brickNum[1],
+				bk = brick / (brickNum[0] * brickNum[1]);
+			int
+				beg[3] = { bi * SDF_BRICK, bj * SDF_BRICK, bk * SDF_BRICK },
+				end[3] = { std::min(beg[0] + SDF_BRICK, grid.size[0]), std::min(beg[1] + SDF_BRICK, grid.size[1]), std::min(beg[2] + SDF_BRICK, grid.size[2]) },
+				rowLength = end[0] - beg[0];
+			Vec3 center = grid.position(beg[0], beg[1], beg[2]) + Vec3{ 1.0, 1.0, 1.0 } * (0.5 * (SDF_BRICK - 1) * grid.spacing);
+
+			for (const BakePrimitive& bp : primitives) {
+				if (bi < bp.brickBeg[0] || bi >= bp.brickEnd[0] ||
+					bj < bp.brickBeg[1] || bj >= bp.brickEnd[1] ||
+					bk < bp.brickBeg[2] || bk >= bp.brickEnd[2])
+					continue;
+
+				// 1. Brick farther than band from full torus is out of band for the patch, too
+				Real centerDistance = bp.patch->signedDistance(bp.toLocal.apply(center));
+				if (centerDistance > band + halfDiagonal)
+					continue;
+				if (centerDistance < -(band + halfDiagonal)) {
+					for (int k = beg[2]; k < end[2]; k++)
+						for (int j = beg[1]; j < end[1]; j++)
+							for (int i = beg[0]; i < end[0]; i++)
+								grid.value(i, j, k) = -band;
+					continue;
+				}
+
+				// 2. Local coordinates of voxels, row by row
+				Vec3 step = bp.toLocal.applyR({ grid.spacing, 0.0, 0.0 });
+				int num = 0;
+				for (int k = beg[2]; k < end[2]; k++) {
+					for (int j = beg[1]; j < end[1]; j++) {
+						Vec3 pt = bp.toLocal.apply(grid.position(beg[0], j, k));
+						for (int i = 0; i < rowLength; i++) {
+							x[num + i] = pt[0] + step[0] * i;
+							y[num + i] = pt[1] + step[1] * i;
+							z[num + i] = pt[2] + step[2] * i;
+						}
+						num += rowLength;
+					}
+				}
+
+				// 3. Closest points on the patch, and sign from implicit function of full torus
+				bp.patch->findMinDistParams(num, x, y, z, u, v, cx, cy, cz, 1);
+				const Real
+					R = bp.patch->majorRadius,
+					rsq = SQ(bp.patch->minorRadius);
+				for (int i = 0; i < num; i++) {
+					Real
+						distance = sqrt(SQ(x[i] - cx[i]) + SQ(y[i] - cy[i]) + SQ(z[i] - cz[i])),
+						rho = sqrt(SQ(x[i]) + SQ(y[i])) - R,
+						implicit = SQ(rho) + SQ(z[i]) - rsq;
+					distance = (implicit < 0) ? -distance : distance;
+					u[i] = std::min(band, std::max(-band, distance));		// Reuse [ u ] for clamped signed distance
+				}
+
+				// 4. Union with other primitives
+				num = 0;
+				for (int k = beg[2]; k < end[2]; k++) {
+					for (int j = beg[1]; j < end[1]; j++) {
+						Real* row = &grid.value(beg[0], j, k);
+						for (int i = 0; i < rowLength; i++)
+							row[i] = std::min(row[i], u[num + i]);
+						num += rowLength;
+					}
+				}
+			}
+		}
+	}
+	void TorusSDF::bake(const std::vector<Primitive>& primitives, Grid& grid, int threadNum) {
+		if (grid.spacing <= 0.0 || grid.size[0] <= 0 || grid.size[1] <= 0 || grid.size[2] <= 0)
+			throw(std::runtime_error("Invalid SDF grid"));
+		grid.values.assign((size_t)grid.size[0] * grid.size[1] * grid.size[2], grid.band);
+
+		int brickNum[3];
+		for (int i = 0; i < 3; i++)
+			brickNum[i] = (grid.size[i] + SDF_BRICK - 1) / SDF_BRICK;
+		std::vector<BakePrimitive> bps;
+		bps.reserve(primitives.size());
+		for (const Primitive& primitive : primitives)
+			bps.push_back(prepare(primitive, grid, brickNum));
+
+		int total = brickNum[0] * brickNum[1] * brickNum[2];
+		if (threadNum <= 0)
+			threadNum = (int)std::thread::hardware_concurrency();
+		threadNum = std::max(1, std::min(threadNum, total));
+		std::vector<std::thread> threads;
+		for (int t = 1; t < threadNum; t++)
+			threads.emplace_back(bakeBricks, std::cref(bps), std::ref(grid), brickNum, t, threadNum);
+		bakeBricks(bps, grid, brickNum, 0, threadNum);
+		for (auto& thread : threads)
+			thread.join();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,61 @@
+/*
+ *******************************************************************************************
+ * Author	: Sang Hyun Son
+ * Email	: shh1295@gmail.com
+ * Github	: github.com/SonSang
+ *******************************************************************************************
+ */
+
+#ifndef __MN_TORUS_SDF_H__
+#define __MN_TORUS_SDF_H__
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#include "Torus.h"
+#include <vector>
+
+namespace MN {
+	// Bakes signed distance field of a set of tori and torus patches into a voxel grid, only in a narrow band around them
+	// Field is the union of primitives : minimum of signed distances, clamped to [ -band, band ]
+	// Distance to each primitive is distance to its patch, and sign is taken from implicit function of its full torus
+	class TorusSDF {
+	public:
+		class Primitive {
+		public:
+			TorusPatch patch;
+			Transform transform;	// Transform that takes local coordinates in torus to world coordinates
+
+			static Primitive create(const Torus& torus, const Transform& transform);
+			static Primitive create(const TorusPatch& patch, const Transform& transform);
+		};
+		class Grid {
+		public:
+			Vec3 origin;			// World position of voxel ( 0, 0, 0 )
+			Real spacing;			// Distance between neighboring voxels
+			int size[3];			// Number of voxels along X, Y, Z
+			Real band;				// Half width of narrow band
+			std::vector<Real> values;	// Signed distance of voxel ( i, j, k ) at [ i + size[0] * ( j + size[1] * k ) ]
+
+			inline Vec3 position(int i, int j, int k) const noexcept {
+				return origin + Vec3{ (Real)i, (Real)j, (Real)k } * spacing;
+			}
+			inline Real& value(int i, int j, int k) noexcept {
+				return values[i + (size_t)size[0] * (j + (size_t)size[1] * k)];
+			}
+			inline Real value(int i, int j, int k) const noexcept {
+				return values[i + (size_t)size[0] * (j + (size_t)size[1] * k)];
+			}
+		};
+
+		// Fill [ grid.values ] with signed distance field of [ primitives ]
+		// Grid is split into bricks, and each brick only examines primitives whose bounding box ( expanded by band ) overlaps it
+		// Bricks that are farther than band from the full torus are skipped, so that they keep [ band ] ( or [ -band ] if deep inside )
+		// Voxels of other bricks are projected onto the patch together by [ TorusPatch::findMinDistParams ]
+		// @threadNum : Number of threads to split bricks, [ std::thread::hardware_concurrency() ] if not positive
+		static void bake(const std::vector<Primitive>& primitives, Grid& grid, int threadNum = 0);
+	};
+}
+
+#endif
\ No newline at end of file